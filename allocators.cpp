@@ -0,0 +1,324 @@
+/*
+* allocators.cpp
+*
+* Implementations for Arena, ArenaAllocator, Pool & PoolAllocator classes
+*
+* @author Juan Arias
+*
+*/
+
+#include <cstdint>
+#include <new>
+#include "allocators.h"
+
+  //**************// //**************// //**************//
+ //*  ARENA:    *// //*  ARENA:    *// //*  ARENA:    *//
+//**************// //**************// //**************//
+
+/*
+* Constructs empty arena
+* @param chunk The size in bytes of each chunk taken from the system
+*/
+inline Arena::Arena(std::size_t chunk) :chunks(nullptr), curr(nullptr), end(nullptr), chunk(chunk) {}
+
+/*
+* Destroys arena and deallocates every chunk
+*/
+inline Arena::~Arena() {
+
+	this->release();
+}
+
+/*
+* Allocates memory from the current chunk, starting a new one if full
+* @param bytes The size of the memory
+* @param alignment The alignment of the memory, a power of 2
+* @return the memory
+*/
+inline void* Arena::allocate(std::size_t bytes, std::size_t alignment) {
+
+	std::uintptr_t aligned = (reinterpret_cast<std::uintptr_t>(this->curr) + alignment - 1) & ~(alignment - 1);
+
+	if (this->curr == nullptr || aligned + bytes > reinterpret_cast<std::uintptr_t>(this->end)) {
+
+		// Requests larger than a chunk get a chunk of their own
+		std::size_t size = sizeof(Chunk) + alignment + bytes;
+
+		if (size < this->chunk) {
+
+			size = this->chunk;
+		}
+
+		Chunk* created = static_cast<Chunk*>(::operator new(size));
+
+		created->next = this->chunks;
+		this->chunks = created;
+
+		this->curr = reinterpret_cast<unsigned char*>(created + 1);
+		this->end = reinterpret_cast<unsigned char*>(created) + size;
+
+		aligned = (reinterpret_cast<std::uintptr_t>(this->curr) + alignment - 1) & ~(alignment - 1);
+	}
+
+	this->curr = reinterpret_cast<unsigned char*>(aligned + bytes);
+
+	return reinterpret_cast<void*>(aligned);
+}
+
+/*
+* Deallocates every chunk, invalidating all memory allocated
+*/
+inline void Arena::release() {
+
+	while (this->chunks != nullptr) {
+
+		Chunk* next = this->chunks->next;
+
+		::operator delete(this->chunks);
+		this->chunks = next;
+	}
+
+	this->curr = nullptr;
+	this->end = nullptr;
+}
+
+/*
+* Constructs allocator from given arena
+* @param arena The arena to allocate from, must outlive the allocator
+*/
+template <class T>
+ArenaAllocator<T>::ArenaAllocator(Arena& arena) noexcept :arena(&arena) {}
+
+/*
+* Constructs allocator of another type from same arena
+* @param other The other allocator
+*/
+template <class T>
+template <class U>
+ArenaAllocator<T>::ArenaAllocator(const ArenaAllocator<U>& other) noexcept :arena(other.arena) {}
+
+/*
+* Allocates uninitialized array
+* @param count The number of values
+* @return the array
+*/
+template <class T>
+T* ArenaAllocator<T>::allocate(std::size_t count) {
+
+	return static_cast<T*>(this->arena->allocate(count * sizeof(T), alignof(T)));
+}
+
+/*
+* Deallocates nothing, the arena frees everything at once
+* @param arr The array
+* @param count The number of values
+*/
+template <class T>
+void ArenaAllocator<T>::deallocate(T* /* arr */, std::size_t /* count */) noexcept {}
+
+/*
+* Equality operator overload
+* @param other The other allocator
+* @return true if both allocate from same arena, else false
+*/
+template <class T>
+template <class U>
+bool ArenaAllocator<T>::operator==(const ArenaAllocator<U>& other) const noexcept {
+
+	return this->arena == other.arena;
+}
+
+/*
+* Inequality operator overload
+* @param other The other allocator
+* @return true if not from same arena, else false
+*/
+template <class T>
+template <class U>
+bool ArenaAllocator<T>::operator!=(const ArenaAllocator<U>& other) const noexcept {
+
+	return this->arena != other.arena;
+}
+
+  //**************// //**************// //**************//
+ //*  POOL:     *// //*  POOL:     *// //*  POOL:     *//
+//**************// //**************// //**************//
+
+/*
+* Static method
+* Allocates a block from the calling thread's lists
+* @param bytes The size of the block
+* @return the block
+*/
+inline void* Pool::allocate(std::size_t bytes) {
+
+	int size = Pool::sizeClass(bytes);
+
+	if (size > Pool::LARGEST) {
+
+		return ::operator new(bytes);
+	}
+
+	Lists& lists = Pool::lists();
+	Block* block = lists.free[size];
+
+	if (block == nullptr) {
+
+		return ::operator new(std::size_t(1) << size);
+	}
+
+	lists.free[size] = block->next;
+	--lists.counts[size];
+
+	return block;
+}
+
+/*
+* Static method
+* Deallocates a block into the calling thread's lists
+* @param block The block
+* @param bytes The size the block was allocated with
+*/
+inline void Pool::deallocate(void* block, std::size_t bytes) {
+
+	int size = Pool::sizeClass(bytes);
+
+	if (size > Pool::LARGEST) {
+
+		::operator delete(block);
+		return;
+	}
+
+	Lists& lists = Pool::lists();
+
+	if (lists.counts[size] >= Pool::KEEP) {
+
+		::operator delete(block);
+		return;
+	}
+
+	Block* freed = static_cast<Block*>(block);
+
+	freed->next = lists.free[size];
+	lists.free[size] = freed;
+	++lists.counts[size];
+}
+
+/*
+* Constructs empty free lists
+*/
+inline Pool::Lists::Lists() {
+
+	for (int size(0); size < 64; ++size) {
+
+		this->free[size] = nullptr;
+		this->counts[size] = 0;
+	}
+}
+
+/*
+* Deallocates every free block
+*/
+inline Pool::Lists::~Lists() {
+
+	for (int size(0); size < 64; ++size) {
+
+		while (this->free[size] != nullptr) {
+
+			Block* next = this->free[size]->next;
+
+			::operator delete(this->free[size]);
+			this->free[size] = next;
+		}
+	}
+}
+
+/*
+* Static method
+* Gets the size class of a block, the power of 2 its size rounds up to
+* @param bytes The size of the block
+* @return the size class
+*/
+inline int Pool::sizeClass(std::size_t bytes) {
+
+	int size(Pool::SMALLEST);
+
+	while ((std::size_t(1) << size) < bytes && size <= Pool::LARGEST) {
+
+		++size;
+	}
+
+	return size;
+}
+
+/*
+* Static method
+* Gets the free lists of the calling thread
+* @return the free lists
+*/
+inline Pool::Lists& Pool::lists() {
+
+	thread_local Lists lists;
+
+	return lists;
+}
+
+/*
+* Constructs allocator
+*/
+template <class T>
+PoolAllocator<T>::PoolAllocator() noexcept {}
+
+/*
+* Constructs allocator of another type
+* @param other The other allocator
+*/
+template <class T>
+template <class U>
+PoolAllocator<T>::PoolAllocator(const PoolAllocator<U>& /* other */) noexcept {}
+
+/*
+* Allocates uninitialized array
+* @param count The number of values
+* @return the array
+*/
+template <class T>
+T* PoolAllocator<T>::allocate(std::size_t count) {
+
+	return static_cast<T*>(Pool::allocate(count * sizeof(T)));
+}
+
+/*
+* Deallocates array into the calling thread's pool
+* @param arr The array
+* @param count The number of values
+*/
+template <class T>
+void PoolAllocator<T>::deallocate(T* arr, std::size_t count) noexcept {
+
+	Pool::deallocate(arr, count * sizeof(T));
+}
+
+/*
+* Equality operator overload
+* @param other The other allocator
+* @return true, every pool allocator is interchangeable
+*/
+template <class T>
+template <class U>
+bool PoolAllocator<T>::operator==(const PoolAllocator<U>& /* other */) const noexcept {
+
+	return true;
+}
+
+/*
+* Inequality operator overload
+* @param other The other allocator
+* @return false, every pool allocator is interchangeable
+*/
+template <class T>
+template <class U>
+bool PoolAllocator<T>::operator!=(const PoolAllocator<U>& /* other */) const noexcept {
+
+	return false;
+}
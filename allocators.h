@@ -0,0 +1,267 @@
+/*
+* allocators.h
+*
+* Specifications for Arena, ArenaAllocator, Pool & PoolAllocator classes
+*
+* @author Juan Arias
+*
+*/
+
+#ifndef ALLOCATORS_H
+#define ALLOCATORS_H
+
+#include <cstddef>
+#include <type_traits>
+
+/*
+* An Arena is a monotonic allocator: it hands out memory from large chunks by
+* bumping a pointer and frees nothing until it is released or destroyed. Suits
+* heaps that are reserved up front or live no longer than the arena.
+*/
+class Arena {
+
+public:
+
+	/*
+	* Constructs empty arena
+	* @param chunk The size in bytes of each chunk taken from the system
+	*/
+	explicit Arena(std::size_t chunk = CHUNK);
+
+	Arena(const Arena& other) = delete;
+	Arena& operator=(const Arena& other) = delete;
+
+	/*
+	* Destroys arena and deallocates every chunk
+	*/
+	~Arena();
+
+	/*
+	* Allocates memory from the current chunk, starting a new one if full
+	* @param bytes The size of the memory
+	* @param alignment The alignment of the memory, a power of 2
+	* @return the memory
+	*/
+	void* allocate(std::size_t bytes, std::size_t alignment);
+
+	/*
+	* Deallocates every chunk, invalidating all memory allocated
+	*/
+	void release();
+
+private:
+
+	// Header of a chunk, followed by its memory
+	struct Chunk {
+
+		Chunk* next;
+	};
+
+	// Chunks taken from the system, newest first
+	Chunk* chunks;
+
+	// Free memory of the newest chunk
+	unsigned char* curr;
+	unsigned char* end;
+
+	// Size in bytes of each chunk
+	std::size_t chunk;
+
+	// Default constant for chunk size
+	static const std::size_t CHUNK = std::size_t(1) << 20;
+
+};
+
+/*
+* An ArenaAllocator is a std::allocator compatible handle to an Arena,
+* deallocating is a no-op as the arena frees everything at once
+*/
+template <class T>
+class ArenaAllocator {
+
+public:
+
+	// Type definition for allocated values
+	using value_type = T;
+
+	/*
+	* Constructs allocator from given arena
+	* @param arena The arena to allocate from, must outlive the allocator
+	*/
+	ArenaAllocator(Arena& arena) noexcept;
+
+	/*
+	* Constructs allocator of another type from same arena
+	* @param other The other allocator
+	*/
+	template <class U>
+	ArenaAllocator(const ArenaAllocator<U>& other) noexcept;
+
+	/*
+	* Allocates uninitialized array
+	* @param count The number of values
+	* @return the array
+	*/
+	T* allocate(std::size_t count);
+
+	/*
+	* Deallocates nothing, the arena frees everything at once
+	* @param arr The array
+	* @param count The number of values
+	*/
+	void deallocate(T* arr, std::size_t count) noexcept;
+
+	/*
+	* Equality operator overload
+	* @param other The other allocator
+	* @return true if both allocate from same arena, else false
+	*/
+	template <class U>
+	bool operator==(const ArenaAllocator<U>& other) const noexcept;
+
+	/*
+	* Inequality operator overload
+	* @param other The other allocator
+	* @return true if not from same arena, else false
+	*/
+	template <class U>
+	bool operator!=(const ArenaAllocator<U>& other) const noexcept;
+
+private:
+
+	template <class U>
+	friend class ArenaAllocator;
+
+	// Arena allocated from
+	Arena* arena;
+
+};
+
+/*
+* Pool keeps freed blocks of each power of 2 size in lists local to the
+* freeing thread and hands them back out before asking the system
+*/
+class Pool {
+
+public:
+
+	/*
+	* Static method
+	* Allocates a block from the calling thread's lists
+	* @param bytes The size of the block
+	* @return the block
+	*/
+	static void* allocate(std::size_t bytes);
+
+	/*
+	* Static method
+	* Deallocates a block into the calling thread's lists
+	* @param block The block
+	* @param bytes The size the block was allocated with
+	*/
+	static void deallocate(void* block, std::size_t bytes);
+
+private:
+
+	// Free blocks of one size, linked through their first bytes
+	struct Block {
+
+		Block* next;
+	};
+
+	// Free lists of the calling thread, deallocated when it exits
+	struct Lists {
+
+		Block* free[64];
+		int counts[64];
+
+		Lists();
+		~Lists();
+	};
+
+	// Constants for smallest & largest pooled size class (powers of 2), larger
+	// blocks go straight to operator delete so no thread caches more than
+	// KEEP blocks of each class, 16 MiB in all
+	static const int SMALLEST = 6, LARGEST = 20;
+
+	// Constant for most free blocks kept per size class
+	static const int KEEP = 8;
+
+	/*
+	* Static method
+	* Gets the size class of a block, the power of 2 its size rounds up to
+	* @param bytes The size of the block
+	* @return the size class
+	*/
+	static int sizeClass(std::size_t bytes);
+
+	/*
+	* Static method
+	* Gets the free lists of the calling thread
+	* @return the free lists
+	*/
+	static Lists& lists();
+
+};
+
+/*
+* A PoolAllocator is a stateless std::allocator compatible allocator backed by
+* the calling thread's Pool, so heaps created & destroyed repeatedly reuse
+* their arrays without going to the system
+*/
+template <class T>
+class PoolAllocator {
+
+	static_assert(alignof(T) <= alignof(std::max_align_t), "PoolAllocator blocks are max_align_t aligned");
+
+public:
+
+	// Type definitions for allocated values & allocator equality
+	using value_type = T;
+	using is_always_equal = std::true_type;
+
+	/*
+	* Constructs allocator
+	*/
+	PoolAllocator() noexcept;
+
+	/*
+	* Constructs allocator of another type
+	* @param other The other allocator
+	*/
+	template <class U>
+	PoolAllocator(const PoolAllocator<U>& other) noexcept;
+
+	/*
+	* Allocates uninitialized array
+	* @param count The number of values
+	* @return the array
+	*/
+	T* allocate(std::size_t count);
+
+	/*
+	* Deallocates array into the calling thread's pool
+	* @param arr The array
+	* @param count The number of values
+	*/
+	void deallocate(T* arr, std::size_t count) noexcept;
+
+	/*
+	* Equality operator overload
+	* @param other The other allocator
+	* @return true, every pool allocator is interchangeable
+	*/
+	template <class U>
+	bool operator==(const PoolAllocator<U>& other) const noexcept;
+
+	/*
+	* Inequality operator overload
+	* @param other The other allocator
+	* @return false, every pool allocator is interchangeable
+	*/
+	template <class U>
+	bool operator!=(const PoolAllocator<U>& other) const noexcept;
+
+};
+#include "allocators.cpp"
+#endif // ALLOCATORS_H
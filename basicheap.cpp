@@ -0,0 +1,1024 @@
+#include "basicheap.h"
+/*
+* basicheap.cpp
+*
+* Implementations for BasicHeap class
+*
+* @author Juan Arias
+*
+*/
+
+  //**************// //**************// //**************//
+ //*  PUBLIC:   *// //*  PUBLIC:   *// //*  PUBLIC:   *//
+//**************// //**************// //**************//
+
+/*
+* Constructs empty heap
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+BasicHeap<T, Compare, Storage, D, Index>::BasicHeap() :Storage(D), comp() {}
+
+/*
+* Constructs empty heap ordered by given comparator
+* @param comp The comparator to order the heap by
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+BasicHeap<T, Compare, Storage, D, Index>::BasicHeap(const Compare& comp) :Storage(D), comp(comp) {}
+
+/*
+* Constructs heap from given array
+* @param arr The array to construct heap from
+* @param size The size of arr
+* @param comp The comparator to order the heap by
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+BasicHeap<T, Compare, Storage, D, Index>::BasicHeap(const T arr[], int size, const Compare& comp)
+	:Storage(arr, size, D), comp(comp) {
+
+	this->create();
+}
+
+/*
+* Constructs heap from given array, forming it on the given number of
+* threads once it holds PARALLEL items or more
+* @param arr The array to construct heap from
+* @param size The size of arr
+* @param comp The comparator to order the heap by
+* @param threads The number of threads to form the heap on
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+BasicHeap<T, Compare, Storage, D, Index>::BasicHeap(const T arr[], int size, const Compare& comp, int threads)
+	:Storage(arr, size, D), comp(comp) {
+
+	this->create(threads);
+}
+
+/*
+* Constructs heap forwarding the given arguments to Storage after the
+* number of children per node, such as an allocator. Items Storage
+* already holds, as a reopened MappedStorage does, must form a heap
+* ordered by Compare & are only indexed, unless Storage reports them
+* out of order
+* @param args The arguments to construct Storage from
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+template <class... Args>
+BasicHeap<T, Compare, Storage, D, Index>::BasicHeap(std::in_place_t, Args&&... args)
+	:Storage(D, std::forward<Args>(args)...), comp() {
+
+	if (this->isOrdered()) {
+
+		this->reindex();
+
+	} else {
+
+		this->create();
+	}
+}
+
+/*
+* Copy constructor overload
+* @param other The other heap to copy
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+BasicHeap<T, Compare, Storage, D, Index>::BasicHeap(const Storage& other)
+	:Storage(D, BasicHeap::copyAllocator(other)), comp() {
+
+	(*this) = other;
+}
+
+/*
+* Copy constructor
+* @param other The other heap to copy
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+BasicHeap<T, Compare, Storage, D, Index>::BasicHeap(const BasicHeap& other)
+	:Storage(D, BasicHeap::copyAllocator(other)), comp(other.comp), index(other.index) {
+
+	this->Storage::operator=(other);
+}
+
+/*
+* Move constructor overload
+* @param other The other heap to move from, left empty & cleared
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+BasicHeap<T, Compare, Storage, D, Index>::BasicHeap(Storage&& other) :Storage(std::move(other)), comp() {
+
+	// Drops what other keeps beside its array, such as the index of a BasicHeap
+	other.clear();
+
+	this->arity = D;
+
+	this->create();
+}
+
+/*
+* Move constructor
+* @param other The other heap to move from, left empty
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+BasicHeap<T, Compare, Storage, D, Index>::BasicHeap(BasicHeap&& other) noexcept
+	:Storage(std::move(other)), comp(std::move(other.comp)), index(std::move(other.index)) {
+
+	other.index.clear();
+}
+
+/*
+* Destroys heap and deallocates all dynamic memory
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+BasicHeap<T, Compare, Storage, D, Index>:: ~BasicHeap() {}
+
+/*
+* Assignment operator overload
+* @param other The other heap to copy
+* @return this heap by reference
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+Storage& BasicHeap<T, Compare, Storage, D, Index>::operator=(const Storage& other) {
+
+	this->Storage::operator=(other);
+
+	this->create();
+
+	return (*this);
+}
+
+/*
+* Assignment operator
+* @param other The other heap to copy
+* @return this heap by reference
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+BasicHeap<T, Compare, Storage, D, Index>& BasicHeap<T, Compare, Storage, D, Index>::operator=(const BasicHeap& other) {
+
+	this->comp = other.comp;
+	this->index = other.index;
+
+	this->Storage::operator=(other);
+
+	return (*this);
+}
+
+/*
+* Move assignment operator overload
+* @param other The other heap to move from, left empty & cleared
+* @return this heap by reference
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+Storage& BasicHeap<T, Compare, Storage, D, Index>::operator=(Storage&& other) {
+
+	if (this == &other) {
+
+		return (*this);
+	}
+
+	this->Storage::operator=(std::move(other));
+
+	// Drops what other keeps beside its array, such as the index of a BasicHeap
+	other.clear();
+
+	this->create();
+
+	return (*this);
+}
+
+/*
+* Move assignment operator
+* @param other The other heap to move from, left empty
+* @return this heap by reference
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+BasicHeap<T, Compare, Storage, D, Index>& BasicHeap<T, Compare, Storage, D, Index>::operator=(BasicHeap&& other) {
+
+	if (this != &other) {
+
+		this->Storage::operator=(std::move(other));
+
+		this->comp = std::move(other.comp);
+		this->index = std::move(other.index);
+
+		other.index.clear();
+	}
+
+	return (*this);
+}
+
+/*
+* Add item to the heap
+* @param item The item to add to the heap
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+void BasicHeap<T, Compare, Storage, D, Index>::add(const T& item) {
+
+	HEAP_SCOPE(this->stats);
+
+	Node curr = this->itemCount;
+	this->append(item);
+	this->index.insert(this->arr[curr]);
+
+	this->bubbleUp(curr);
+}
+
+/*
+* Add item to the heap by moving it
+* @param item The item to move into the heap
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+void BasicHeap<T, Compare, Storage, D, Index>::add(T&& item) {
+
+	HEAP_SCOPE(this->stats);
+
+	Node curr = this->itemCount;
+	this->append(std::move(item));
+	this->index.insert(this->arr[curr]);
+
+	this->bubbleUp(curr);
+}
+
+/*
+* Construct item in place at the end of the heap and bubble it up
+* @param args The arguments to construct the item from
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+template <class... Args>
+void BasicHeap<T, Compare, Storage, D, Index>::emplace(Args&&... args) {
+
+	HEAP_SCOPE(this->stats);
+
+	Node curr = this->itemCount;
+	this->append(std::forward<Args>(args)...);
+	this->index.insert(this->arr[curr]);
+
+	this->bubbleUp(curr);
+}
+
+/*
+* Replace the peek item in the heap with the given item, trickling it
+* down once instead of removing & adding, adds item if empty
+* @param item The item to replace the peek item with
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+void BasicHeap<T, Compare, Storage, D, Index>::replaceTop(const T& item) {
+
+	HEAP_SCOPE(this->stats);
+
+	if (this->isEmpty()) {
+
+		this->add(item);
+		return;
+	}
+
+	this->index.erase(this->arr[Storage::ROOT]);
+
+	this->arr[Storage::ROOT] = item;
+	this->index.insert(this->arr[Storage::ROOT]);
+
+	BasicHeap::bounce(this->arr, this->itemCount, Storage::ROOT, this->comp);
+}
+
+/*
+* Replace the peek item in the heap by moving the given item, trickling
+* it down once instead of removing & adding, adds item if empty
+* @param item The item to move into the heap
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+void BasicHeap<T, Compare, Storage, D, Index>::replaceTop(T&& item) {
+
+	HEAP_SCOPE(this->stats);
+
+	if (this->isEmpty()) {
+
+		this->add(std::move(item));
+		return;
+	}
+
+	this->index.erase(this->arr[Storage::ROOT]);
+
+	this->arr[Storage::ROOT] = std::move(item);
+	this->index.insert(this->arr[Storage::ROOT]);
+
+	BasicHeap::bounce(this->arr, this->itemCount, Storage::ROOT, this->comp);
+}
+
+/*
+* Add every item in the range to the heap, appending them all and forming
+* the heap once in O(n + k) when k is large relative to the n items in the heap
+* @param first The iterator to the first item to add
+* @param last The iterator past the last item to add
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+template <class Iterator>
+void BasicHeap<T, Compare, Storage, D, Index>::addRange(Iterator first, Iterator last) {
+
+	HEAP_SCOPE(this->stats);
+
+	using Category = typename std::iterator_traits<Iterator>::iterator_category;
+
+	if constexpr (std::is_base_of<std::forward_iterator_tag, Category>::value) {
+
+		this->reserve(this->itemCount + static_cast<int>(std::distance(first, last)));
+	}
+
+	Node start = this->itemCount;
+
+	for (; first != last; ++first) {
+
+		this->append(*first);
+		this->index.insert(this->arr[this->itemCount - 1]);
+	}
+
+	int height(0);
+
+	for (int nodes(this->itemCount); nodes > Storage::EMPTY; nodes /= D) {
+
+		++height;
+	}
+
+	// Bubbling k items up costs about k * height, heapifying their ancestors about k + height^2
+	if (static_cast<long long>(this->itemCount - start) * height > this->itemCount) {
+
+		this->heapify(start);
+
+	} else {
+
+		for (Node curr(start); curr < this->itemCount; ++curr) {
+
+			this->bubbleUp(curr);
+		}
+	}
+}
+
+/*
+* Add every item in the array to the heap, re-forming only the nodes
+* above the appended items
+* @param items The array of items to add
+* @param count The number of items
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+void BasicHeap<T, Compare, Storage, D, Index>::pushBatch(const T items[], int count) {
+
+	this->addRange(items, items + count);
+}
+
+/*
+* Move every item of the other heap into this heap, appending them all
+* and forming the heap once in O(n + k)
+* @param other The other heap, left empty
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+void BasicHeap<T, Compare, Storage, D, Index>::meld(BasicHeap&& other) {
+
+	if (this == &other) {
+
+		return;
+	}
+
+	this->addRange(std::make_move_iterator(other.arr), std::make_move_iterator(other.arr + other.itemCount));
+
+	other.clear();
+}
+
+/*
+* Remove the peek item in the heap and return it
+* @return the peek item, moved out of the heap
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+T BasicHeap<T, Compare, Storage, D, Index>::pop() {
+
+	HEAP_SCOPE(this->stats);
+
+	// The index must see the item before it is moved from
+	this->index.erase(this->peek());
+
+	T top = std::move(this->arr[Storage::ROOT]);
+
+	this->removeRoot();
+
+	return top;
+}
+
+/*
+* Remove the peek item in the heap
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+void BasicHeap<T, Compare, Storage, D, Index>::remove() {
+
+	HEAP_SCOPE(this->stats);
+
+	if (this->itemCount > Storage::EMPTY) {
+
+		this->index.erase(this->arr[Storage::ROOT]);
+
+		this->removeRoot();
+	}
+}
+
+/*
+* Remove the count peek items in the heap, a convenience loop over pop
+* with no performance benefit over popping one at a time
+* @param count The number of items to remove
+* @param out The array to move the removed items into, in priority order
+* @return the number of items removed, fewer than count if the heap empties
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+int BasicHeap<T, Compare, Storage, D, Index>::popBatch(int count, T out[]) {
+
+	// A frontier heap of the nodes under those taken, filling the holes once
+	// at the end, measured slower: every hole still sinks through the heap
+	count = std::max(std::min(count, this->itemCount), 0);
+
+	for (int i(0); i < count; ++i) {
+
+		out[i] = this->pop();
+	}
+
+	return count;
+}
+
+/*
+* Sorts the items in place into priority order, the peek item first, which
+* still forms a heap, so begin() to end() then visits them in order
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+void BasicHeap<T, Compare, Storage, D, Index>::sort() {
+
+	HEAP_SCOPE(this->stats);
+
+	BasicHeap::maxHeapSort(this->arr, this->itemCount, this->comp);
+
+	std::reverse(this->arr, this->arr + this->itemCount);
+}
+
+/*
+* Check if item is in the heap
+* @param item The item to search for
+* @return true if found, else false
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+bool BasicHeap<T, Compare, Storage, D, Index>::contains(const T& item) {
+
+	if constexpr (Index::ENABLED) {
+
+		return this->index.contains(item);
+	}
+
+	bool found(false);
+
+	if (!this->isEmpty() && !this->comp(this->peek(), item)) {
+
+		for (Node curr(Storage::ROOT); curr < this->itemCount && !found; ++curr) {
+
+			found = (this->arr[curr] == item);
+		}
+	}
+
+	return found;
+}
+
+/*
+* Clear the heap
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+void BasicHeap<T, Compare, Storage, D, Index>::clear() {
+
+	this->index.clear();
+
+	this->Storage::clear();
+}
+
+/*
+* Static method
+* Heap sorts the given array
+* @param arr The array to sort
+* @param size The size of arr
+* @param comp The comparator to sort by
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+void BasicHeap<T, Compare, Storage, D, Index>::maxHeapSort(T arr[], int size, const Compare& comp) {
+
+	if (size < 2) {
+
+		return;
+	}
+
+	for (Node curr(Storage::parent(size - 1, D)); curr >= Storage::ROOT; --curr) {
+
+		BasicHeap::bounce(arr, size, curr, comp);
+	}
+
+	while (size > 1) {
+
+		Storage::swap(arr, Storage::ROOT, --size);
+
+		BasicHeap::bounce(arr, size, Storage::ROOT, comp);
+	}
+}
+
+/*
+* Static method
+* Heap sorts the given array on the given number of threads once it holds
+* PARALLEL items or more: each thread heap sorts a slice, then the slices
+* are merged pairwise, each round of merges in parallel
+* @param arr The array to sort
+* @param size The size of arr
+* @param comp The comparator to sort by
+* @param threads The number of threads to sort on
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+void BasicHeap<T, Compare, Storage, D, Index>::maxHeapSort(T arr[], int size, const Compare& comp, int threads) {
+
+	if (threads <= 1 || size < BasicHeap::PARALLEL) {
+
+		BasicHeap::maxHeapSort(arr, size, comp);
+		return;
+	}
+
+	std::vector<int> bounds(threads + 1);
+
+	for (int slice(0); slice <= threads; ++slice) {
+
+		bounds[slice] = static_cast<int>(static_cast<long long>(size) * slice / threads);
+	}
+
+	parallelFor(threads, threads, [&](int slice) {
+
+		BasicHeap::maxHeapSort(arr + bounds[slice], bounds[slice + 1] - bounds[slice], comp);
+	});
+
+	for (int width(1); width < threads; width *= 2) {
+
+		parallelFor((threads + 2 * width - 1) / (2 * width), threads, [&](int merge) {
+
+			int first = merge * 2 * width;
+			int middle = std::min(first + width, threads);
+			int last = std::min(first + 2 * width, threads);
+
+			std::inplace_merge(arr + bounds[first], arr + bounds[middle], arr + bounds[last], comp);
+		});
+	}
+}
+
+/*
+* Get an iterator visiting the items in priority order, leaving the heap unchanged
+* @return an iterator at the peek item
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+typename BasicHeap<T, Compare, Storage, D, Index>::OrderedIterator BasicHeap<T, Compare, Storage, D, Index>::orderedBegin() const {
+
+	return OrderedIterator(this);
+}
+
+/*
+* Get the end of the items in priority order
+* @return an iterator past the last item
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+typename BasicHeap<T, Compare, Storage, D, Index>::OrderedIterator BasicHeap<T, Compare, Storage, D, Index>::orderedEnd() const {
+
+	return OrderedIterator();
+}
+
+/*
+* Constructs iterator at the peek item of the given heap, or at the
+* end if null or empty
+* @param heap The heap to visit
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+BasicHeap<T, Compare, Storage, D, Index>::OrderedIterator::OrderedIterator(const BasicHeap* heap)
+	:heap(heap), frontier(NodeCompare{heap}) {
+
+	if (heap != nullptr && !heap->isEmpty()) {
+
+		this->frontier.add(Node(Storage::ROOT));
+	}
+}
+
+/*
+* Dereference operator overload
+* @return the item visited
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+const T& BasicHeap<T, Compare, Storage, D, Index>::OrderedIterator::operator*() const {
+
+	return this->heap->arr[this->frontier.peek()];
+}
+
+/*
+* Member access operator overload
+* @return a pointer to the item visited
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+const T* BasicHeap<T, Compare, Storage, D, Index>::OrderedIterator::operator->() const {
+
+	return &this->heap->arr[this->frontier.peek()];
+}
+
+/*
+* Prefix increment operator overload, visiting the next item
+* @return this iterator by reference
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+typename BasicHeap<T, Compare, Storage, D, Index>::OrderedIterator&
+BasicHeap<T, Compare, Storage, D, Index>::OrderedIterator::operator++() {
+
+	Node first = Storage::left(this->frontier.pop(), D);
+	Node last = std::min(first + D, this->heap->itemCount);
+
+	// Children of the node visited are the only items that may come next
+	for (Node child = first; child < last; ++child) {
+
+		this->frontier.add(child);
+	}
+
+	return (*this);
+}
+
+/*
+* Postfix increment operator overload, visiting the next item
+* @return a copy of this iterator before it was incremented
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+typename BasicHeap<T, Compare, Storage, D, Index>::OrderedIterator
+BasicHeap<T, Compare, Storage, D, Index>::OrderedIterator::operator++(int) {
+
+	OrderedIterator copy(*this);
+
+	++(*this);
+
+	return copy;
+}
+
+/*
+* Equality operator overload
+* @param other The other iterator to compare
+* @return true if both visit the same node or are at the end, else false
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+bool BasicHeap<T, Compare, Storage, D, Index>::OrderedIterator::operator==(const OrderedIterator& other) const {
+
+	if (this->frontier.isEmpty() || other.frontier.isEmpty()) {
+
+		return this->frontier.isEmpty() && other.frontier.isEmpty();
+	}
+
+	return this->heap == other.heap && this->frontier.peek() == other.frontier.peek();
+}
+
+/*
+* Inequality operator overload
+* @param other The other iterator to compare
+* @return true if not equal, else false
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+bool BasicHeap<T, Compare, Storage, D, Index>::OrderedIterator::operator!=(const OrderedIterator& other) const {
+
+	return !((*this) == other);
+}
+
+  //**************// //**************// //**************//
+ //*  PRIVATE:  *// //*  PRIVATE:  *// //*  PRIVATE:  *//
+//**************// //**************// //**************//
+
+/*
+* Static method
+* Gets the allocator a copy of the given heap allocates with
+* @param other The heap being copied
+* @return the allocator for the copy
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+typename Storage::allocator_type BasicHeap<T, Compare, Storage, D, Index>::copyAllocator(const Storage& other) {
+
+	using Traits = std::allocator_traits<typename Storage::allocator_type>;
+
+	return Traits::select_on_container_copy_construction(other.getAllocator());
+}
+
+/*
+* Helper function for array constructor, indexes every item and forms heap
+* @param threads The number of threads to form the heap on
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+void BasicHeap<T, Compare, Storage, D, Index>::create(int threads) {
+
+	HEAP_SCOPE(this->stats);
+
+	this->reindex();
+
+	if (threads > 1 && this->itemCount >= BasicHeap::PARALLEL) {
+
+		BasicHeap::heapify(this->arr, this->itemCount, this->comp, threads);
+
+	} else {
+
+		this->heapify();
+	}
+}
+
+/*
+* Indexes every item in the array, if the heap has an index
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+void BasicHeap<T, Compare, Storage, D, Index>::reindex() {
+
+	if constexpr (Index::ENABLED) {
+
+		this->index.clear();
+
+		for (Node curr(Storage::ROOT); curr < this->itemCount; ++curr) {
+
+			this->index.insert(this->arr[curr]);
+		}
+	}
+}
+
+/*
+* Moves the last item into the root and bounces it down, the heap must not
+* be empty and the index must no longer hold the root
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+void BasicHeap<T, Compare, Storage, D, Index>::removeRoot() {
+
+	HeapStats::remove();
+
+	if (--this->itemCount > Storage::EMPTY) {
+
+		this->arr[Storage::ROOT] = std::move(this->arr[this->itemCount]);
+	}
+
+	this->arr[this->itemCount].~T();
+
+	BasicHeap::bounce(this->arr, this->itemCount, Storage::ROOT, this->comp);
+}
+
+/*
+* Forms heap from every item in the array, bottom-up
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+void BasicHeap<T, Compare, Storage, D, Index>::heapify() {
+
+	for (Node curr(Storage::parent(this->itemCount - 1, D)); curr >= Storage::ROOT; --curr) {
+
+		BasicHeap::bounce(this->arr, this->itemCount, curr, this->comp);
+	}
+}
+
+/*
+* Static method
+* Forms heap from every item in the given array on the given number of
+* threads: each thread forms the subtrees of a slice of one level bottom-up,
+* level by level, then the levels above are formed on the calling thread
+* @param arr The array to form heap from
+* @param size The size of arr
+* @param comp The comparator ordering the heap
+* @param threads The number of threads to form the heap on
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+void BasicHeap<T, Compare, Storage, D, Index>::heapify(T arr[], int size, const Compare& comp, int threads) {
+
+	long long last = Storage::parent(size - 1, D);
+
+	// First level with enough subtrees for every slice, or the last level with children
+	long long level(Storage::ROOT), width(1);
+
+	while (width < static_cast<long long>(threads) * BasicHeap::SLICES && level + width <= last) {
+
+		level += width;
+		width *= D;
+	}
+
+	long long roots = std::min(level + width, last + 1) - level;
+	int slices = static_cast<int>(std::min<long long>(roots, static_cast<long long>(threads) * BasicHeap::SLICES));
+
+	parallelFor(slices, threads, [&](int slice) {
+
+		// Descendants of a run of nodes on one level are a run on every level below
+		std::vector<std::pair<long long, long long>> runs;
+
+		long long first = level + roots * slice / slices;
+		long long end = level + roots * (slice + 1) / slices;
+
+		while (first <= last) {
+
+			runs.emplace_back(first, std::min(end, last + 1));
+
+			first = first * D + 1;
+			end = end * D + 1;
+		}
+
+		for (auto run = runs.rbegin(); run != runs.rend(); ++run) {
+
+			for (long long curr(run->second - 1); curr >= run->first; --curr) {
+
+				BasicHeap::bounce(arr, size, static_cast<Node>(curr), comp);
+			}
+		}
+	});
+
+	for (long long curr(level - 1); curr >= Storage::ROOT; --curr) {
+
+		BasicHeap::bounce(arr, size, static_cast<Node>(curr), comp);
+	}
+}
+
+/*
+* Forms heap after items were appended, rebuilding only their ancestors
+* level by level, bottom-up
+* @param start The first appended node
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+void BasicHeap<T, Compare, Storage, D, Index>::heapify(Node start) {
+
+	if (start >= this->itemCount) {
+
+		return;
+	}
+
+	// Ancestors of the appended nodes are a contiguous range on every level
+	Node low = Storage::parent(start, D), high = Storage::parent(this->itemCount - 1, D);
+
+	while (true) {
+
+		for (Node curr(high); curr >= low; --curr) {
+
+			BasicHeap::bounce(this->arr, this->itemCount, curr, this->comp);
+		}
+
+		if (low == Storage::ROOT) {
+
+			break;
+		}
+
+		high = std::min(Storage::parent(high, D), low - 1);
+		low = Storage::parent(low, D);
+	}
+}
+
+/*
+* Bubbles node up heap until in correct position,
+* moving parents down into the hole left by the node
+* @param curr The current node in the heap
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+void BasicHeap<T, Compare, Storage, D, Index>::bubbleUp(Node curr) {
+
+	T item = std::move(this->arr[curr]);
+	int depth(0), comparisons(0);
+
+	while (curr > Storage::ROOT) {
+
+		Node parent = Storage::parent(curr, D);
+
+		++comparisons;
+
+		if (!this->comp(this->arr[parent], item)) {
+
+			break;
+		}
+
+		this->arr[curr] = std::move(this->arr[parent]);
+		curr = parent;
+		++depth;
+	}
+
+	this->arr[curr] = std::move(item);
+
+	HeapStats::compare(comparisons);
+	HeapStats::move(depth + 2);
+	HeapStats::sift(depth);
+}
+
+/*
+* Trickles nodes down heap until in correct position
+* @param curr The current node in the heap
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+void BasicHeap<T, Compare, Storage, D, Index>::rebuild(Node curr) {
+
+	BasicHeap::rebuild(this->arr, this->itemCount, curr, this->comp);
+}
+
+/*
+* Static method
+* Trickles nodes down given heap array until in correct position,
+* moving children up into the hole left by the node
+* @param arr The heap array to rebuild
+* @param size The size of arr
+* @param curr The current node in the heap
+* @param comp The comparator ordering the heap
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+void BasicHeap<T, Compare, Storage, D, Index>::rebuild(T arr[], int size, Node curr, const Compare& comp) {
+
+	if (Storage::isLeaf(curr, size, D)) {
+
+		return;
+	}
+
+	T item = std::move(arr[curr]);
+	int depth(0), comparisons(0);
+
+	while (!Storage::isLeaf(curr, size, D)) {
+
+		Node larger = BasicHeap::largerChild(arr, size, curr, comp);
+
+		// Picking the larger of the children & comparing the item with it
+		comparisons += std::min(D, size - Storage::left(curr, D));
+
+		if (!comp(item, arr[larger])) {
+
+			break;
+		}
+
+		arr[curr] = std::move(arr[larger]);
+		curr = larger;
+		++depth;
+	}
+
+	arr[curr] = std::move(item);
+
+	HeapStats::compare(comparisons);
+	HeapStats::move(depth + 2);
+	HeapStats::sift(depth);
+}
+
+/*
+* Static method
+* Trickles nodes down given heap array bottom-up: moves the larger child
+* up until reaching a leaf, then bounces the node back up to its position.
+* Saves a comparison per level when the node belongs near the bottom, as
+* the last item moved to the root in remove does.
+* @param arr The heap array to rebuild
+* @param size The size of arr
+* @param curr The current node in the heap
+* @param comp The comparator ordering the heap
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+void BasicHeap<T, Compare, Storage, D, Index>::bounce(T arr[], int size, Node curr, const Compare& comp) {
+
+	if (Storage::isLeaf(curr, size, D)) {
+
+		return;
+	}
+
+	Node start = curr;
+	T item = std::move(arr[curr]);
+	int down(0), up(0), comparisons(0);
+
+	while (!Storage::isLeaf(curr, size, D)) {
+
+		Node larger = BasicHeap::largerChild(arr, size, curr, comp);
+
+		comparisons += std::min(D, size - Storage::left(curr, D)) - 1;
+
+		arr[curr] = std::move(arr[larger]);
+		curr = larger;
+		++down;
+	}
+
+	while (curr > start) {
+
+		Node parent = Storage::parent(curr, D);
+
+		++comparisons;
+
+		if (!comp(arr[parent], item)) {
+
+			break;
+		}
+
+		arr[curr] = std::move(arr[parent]);
+		curr = parent;
+		++up;
+	}
+
+	arr[curr] = std::move(item);
+
+	HeapStats::compare(comparisons);
+	HeapStats::move(down + up + 2);
+	HeapStats::sift(down - up);
+}
+
+/*
+* Static method
+* Gets the larger of the given node's children, using ChildSelect
+* when the node has all D children
+* @param arr The heap array
+* @param size The size of arr
+* @param curr The current node in the heap
+* @param comp The comparator ordering the heap
+* @return the larger child
+*/
+template <class T, class Compare, class Storage, int D, class Index>
+Node BasicHeap<T, Compare, Storage, D, Index>::largerChild(T arr[], int size, Node curr, const Compare& comp) {
+
+	Node first = Storage::left(curr, D);
+
+	if (first + D <= size) {
+
+		return first + ChildSelect<T, D, Compare>::larger(&arr[first], comp);
+	}
+
+	return Storage::largerChild(arr, size, curr, comp, D);
+}
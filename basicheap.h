@@ -0,0 +1,458 @@
+/*
+* basicheap.h
+*
+* Specifications for BasicHeap class
+*
+* @author Juan Arias
+*
+*/
+
+#ifndef BASICHEAP_H
+#define BASICHEAP_H
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "heap.h"
+#include "childselect.h"
+#include "heapindex.h"
+#include "parallel.h"
+
+/*
+* A BasicHeap is an implementation of the Heap interface that prioritizes
+* the value that compares greatest by Compare, storing its items in Storage
+* as a D-ary tree. An Index such as HashIndex makes contains O(1) expected.
+* The class is final so calls made through a BasicHeap are not dispatched
+* through the vtable, letting the comparator inline into bubbleUp & rebuild.
+*/
+template <class T, class Compare = std::less<T>, class Storage = Heap<T>, int D = 2,
+          class Index = NoIndex<T>>
+class BasicHeap final : public Storage {
+
+	static_assert(D >= 2, "BasicHeap needs at least two children per node");
+
+public:
+
+	/*
+	* An OrderedIterator visits the items of a heap in priority order without
+	* changing it, keeping a frontier heap of the nodes whose parents were
+	* visited, so visiting the first k items takes O(k log k). Any change to
+	* the heap invalidates it.
+	*/
+	class OrderedIterator {
+
+	public:
+
+		// Type definitions for iterator traits
+		using iterator_category = std::input_iterator_tag;
+		using value_type = T;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const T*;
+		using reference = const T&;
+
+		/*
+		* Constructs iterator at the peek item of the given heap, or at the
+		* end if null or empty
+		* @param heap The heap to visit
+		*/
+		explicit OrderedIterator(const BasicHeap* heap = nullptr);
+
+		/*
+		* Dereference operator overload
+		* @return the item visited
+		*/
+		const T& operator*() const;
+
+		/*
+		* Member access operator overload
+		* @return a pointer to the item visited
+		*/
+		const T* operator->() const;
+
+		/*
+		* Prefix increment operator overload, visiting the next item
+		* @return this iterator by reference
+		*/
+		OrderedIterator& operator++();
+
+		/*
+		* Postfix increment operator overload, visiting the next item
+		* @return a copy of this iterator before it was incremented
+		*/
+		OrderedIterator operator++(int);
+
+		/*
+		* Equality operator overload
+		* @param other The other iterator to compare
+		* @return true if both visit the same node or are at the end, else false
+		*/
+		bool operator==(const OrderedIterator& other) const;
+
+		/*
+		* Inequality operator overload
+		* @param other The other iterator to compare
+		* @return true if not equal, else false
+		*/
+		bool operator!=(const OrderedIterator& other) const;
+
+	private:
+
+		// Comparator ordering nodes by the priority of their items
+		struct NodeCompare {
+
+			const BasicHeap* heap;
+
+			bool operator()(Node node1, Node node2) const { return this->heap->comp(this->heap->arr[node1], this->heap->arr[node2]); }
+		};
+
+		// Heap visited
+		const BasicHeap* heap;
+
+		// Nodes not yet visited whose parents were, the node visited in the root
+		BasicHeap<Node, NodeCompare> frontier;
+	};
+
+	/*
+	* Constructs empty heap
+	*/
+	BasicHeap();
+
+	/*
+	* Constructs empty heap ordered by given comparator
+	* @param comp The comparator to order the heap by
+	*/
+	explicit BasicHeap(const Compare& comp);
+
+	/*
+	* Constructs heap from given array
+	* @param arr The array to construct heap from
+	* @param size The size of arr
+	* @param comp The comparator to order the heap by
+	*/
+	BasicHeap(const T arr[], int size, const Compare& comp = Compare());
+
+	/*
+	* Constructs heap from given array, forming it on the given number of
+	* threads once it holds PARALLEL items or more
+	* @param arr The array to construct heap from
+	* @param size The size of arr
+	* @param comp The comparator to order the heap by
+	* @param threads The number of threads to form the heap on
+	*/
+	BasicHeap(const T arr[], int size, const Compare& comp, int threads);
+
+	/*
+	* Constructs heap forwarding the given arguments to Storage after the
+	* number of children per node, such as an allocator. Items Storage
+	* already holds, as a reopened MappedStorage does, must form a heap
+	* ordered by Compare & are only indexed, unless Storage reports them
+	* out of order
+	* @param args The arguments to construct Storage from
+	*/
+	template <class... Args>
+	explicit BasicHeap(std::in_place_t, Args&&... args);
+
+	/*
+	* Copy constructor overload
+	* @param other The other heap to copy
+	*/
+	BasicHeap(const Storage& other);
+
+	/*
+	* Copy constructor
+	* @param other The other heap to copy
+	*/
+	BasicHeap(const BasicHeap& other);
+
+	/*
+	* Move constructor overload
+	* @param other The other heap to move from, left empty & cleared
+	*/
+	BasicHeap(Storage&& other);
+
+	/*
+	* Move constructor
+	* @param other The other heap to move from, left empty
+	*/
+	BasicHeap(BasicHeap&& other) noexcept;
+
+	/*
+	* Destroys heap and deallocates all dynamic memory
+	*/
+	virtual ~BasicHeap();
+
+	/*
+	* Assignment operator overload
+	* @param other The other heap to copy
+	* @return this heap by reference
+	*/
+	Storage& operator=(const Storage& other) override;
+
+	/*
+	* Assignment operator
+	* @param other The other heap to copy
+	* @return this heap by reference
+	*/
+	BasicHeap& operator=(const BasicHeap& other);
+
+	/*
+	* Move assignment operator overload
+	* @param other The other heap to move from, left empty & cleared
+	* @return this heap by reference
+	*/
+	Storage& operator=(Storage&& other) override;
+
+	/*
+	* Move assignment operator
+	* @param other The other heap to move from, left empty
+	* @return this heap by reference
+	*/
+	BasicHeap& operator=(BasicHeap&& other);
+
+	/*
+	* Remove the peek item in the heap
+	*/
+	void remove() override;
+
+	/*
+	* Add item to the heap
+	* @param item The item to add to the heap
+	*/
+	void add(const T& item) override;
+
+	/*
+	* Add item to the heap by moving it
+	* @param item The item to move into the heap
+	*/
+	void add(T&& item) override;
+
+	/*
+	* Construct item in place at the end of the heap and bubble it up
+	* @param args The arguments to construct the item from
+	*/
+	template <class... Args>
+	void emplace(Args&&... args);
+
+	/*
+	* Replace the peek item in the heap with the given item, trickling it
+	* down once instead of removing & adding, adds item if empty
+	* @param item The item to replace the peek item with
+	*/
+	void replaceTop(const T& item);
+
+	/*
+	* Replace the peek item in the heap by moving the given item, trickling
+	* it down once instead of removing & adding, adds item if empty
+	* @param item The item to move into the heap
+	*/
+	void replaceTop(T&& item);
+
+	/*
+	* Add every item in the range to the heap, appending them all and forming
+	* the heap once in O(n + k) when k is large relative to the n items in the heap
+	* @param first The iterator to the first item to add
+	* @param last The iterator past the last item to add
+	*/
+	template <class Iterator>
+	void addRange(Iterator first, Iterator last);
+
+	/*
+	* Add every item in the array to the heap, re-forming only the nodes
+	* above the appended items
+	* @param items The array of items to add
+	* @param count The number of items
+	*/
+	void pushBatch(const T items[], int count);
+
+	/*
+	* Move every item of the other heap into this heap, appending them all
+	* and forming the heap once in O(n + k)
+	* @param other The other heap, left empty
+	*/
+	void meld(BasicHeap&& other);
+
+	/*
+	* Remove the peek item in the heap and return it
+	* @return the peek item, moved out of the heap
+	*/
+	T pop();
+
+	/*
+	* Remove the count peek items in the heap, a convenience loop over pop
+	* with no performance benefit over popping one at a time
+	* @param count The number of items to remove
+	* @param out The array to move the removed items into, in priority order
+	* @return the number of items removed, fewer than count if the heap empties
+	*/
+	int popBatch(int count, T out[]);
+
+	/*
+	* Sorts the items in place into priority order, the peek item first, which
+	* still forms a heap, so begin() to end() then visits them in order
+	*/
+	void sort();
+
+	/*
+	* Check if item is in the heap
+	* @param item The item to search for
+	* @return true if found, else false
+	*/
+	bool contains(const T& item) override;
+
+	/*
+	* Clear the heap
+	*/
+	void clear() override;
+
+	/*
+	* Static method
+	* Heap sorts the given array
+	* @param arr The array to sort
+	* @param size The size of arr
+	* @param comp The comparator to sort by
+	*/
+	static void maxHeapSort(T arr[], int size, const Compare& comp = Compare());
+
+	/*
+	* Static method
+	* Heap sorts the given array on the given number of threads once it holds
+	* PARALLEL items or more: each thread heap sorts a slice, then the slices
+	* are merged pairwise, each round of merges in parallel
+	* @param arr The array to sort
+	* @param size The size of arr
+	* @param comp The comparator to sort by
+	* @param threads The number of threads to sort on
+	*/
+	static void maxHeapSort(T arr[], int size, const Compare& comp, int threads);
+
+	/*
+	* Get an iterator visiting the items in priority order, leaving the heap unchanged
+	* @return an iterator at the peek item
+	*/
+	OrderedIterator orderedBegin() const;
+
+	/*
+	* Get the end of the items in priority order
+	* @return an iterator past the last item
+	*/
+	OrderedIterator orderedEnd() const;
+
+private:
+
+	// Comparator ordering the heap, comp(a, b) is true if b has priority
+	Compare comp;
+
+	// Index of the items in the heap, kept in step by add & remove
+	Index index;
+
+	// Constant for items below which heapify & sort stay on one thread
+	static const int PARALLEL = 1 << 16;
+
+	// Constant for slices of the heap formed per thread, balancing uneven slices
+	static const int SLICES = 4;
+
+	/*
+	* Static method
+	* Gets the allocator a copy of the given heap allocates with
+	* @param other The heap being copied
+	* @return the allocator for the copy
+	*/
+	static typename Storage::allocator_type copyAllocator(const Storage& other);
+
+	/*
+	* Helper function for array constructor, indexes every item and forms heap
+	* @param threads The number of threads to form the heap on
+	*/
+	void create(int threads = 1);
+
+	/*
+	* Indexes every item in the array, if the heap has an index
+	*/
+	void reindex();
+
+	/*
+	* Moves the last item into the root and bounces it down, the heap must not
+	* be empty and the index must no longer hold the root
+	*/
+	void removeRoot();
+
+	/*
+	* Forms heap from every item in the array, bottom-up
+	*/
+	void heapify();
+
+	/*
+	* Static method
+	* Forms heap from every item in the given array on the given number of
+	* threads: each thread forms the subtrees of a slice of one level bottom-up,
+	* level by level, then the levels above are formed on the calling thread
+	* @param arr The array to form heap from
+	* @param size The size of arr
+	* @param comp The comparator ordering the heap
+	* @param threads The number of threads to form the heap on
+	*/
+	static void heapify(T arr[], int size, const Compare& comp, int threads);
+
+	/*
+	* Forms heap after items were appended, rebuilding only their ancestors
+	* level by level, bottom-up
+	* @param start The first appended node
+	*/
+	void heapify(Node start);
+
+	/*
+	* Bubbles node up heap until in correct position,
+	* moving parents down into the hole left by the node
+	* @param curr The current node in the heap
+	*/
+	void bubbleUp(Node curr);
+
+	/*
+	* Trickles nodes down heap until in correct position
+	* @param curr The current node in the heap
+	*/
+	void rebuild(Node curr);
+
+	/*
+	* Static method
+	* Trickles nodes down given heap array until in correct position,
+	* moving children up into the hole left by the node
+	* @param arr The heap array to rebuild
+	* @param size The size of arr
+	* @param curr The current node in the heap
+	* @param comp The comparator ordering the heap
+	*/
+	static void rebuild(T arr[], int size, Node curr, const Compare& comp);
+
+	/*
+	* Static method
+	* Trickles nodes down given heap array bottom-up: moves the larger child
+	* up until reaching a leaf, then bounces the node back up to its position.
+	* Saves a comparison per level when the node belongs near the bottom, as
+	* the last item moved to the root in remove does.
+	* @param arr The heap array to rebuild
+	* @param size The size of arr
+	* @param curr The current node in the heap
+	* @param comp The comparator ordering the heap
+	*/
+	static void bounce(T arr[], int size, Node curr, const Compare& comp);
+
+	/*
+	* Static method
+	* Gets the larger of the given node's children, using ChildSelect
+	* when the node has all D children
+	* @param arr The heap array
+	* @param size The size of arr
+	* @param curr The current node in the heap
+	* @param comp The comparator ordering the heap
+	* @return the larger child
+	*/
+	static Node largerChild(T arr[], int size, Node curr, const Compare& comp);
+
+};
+#include "basicheap.cpp"
+#endif // BASICHEAP_H
@@ -0,0 +1,628 @@
+/*
+* bench.cpp
+*
+* Benchmarks for Heap implementations
+*
+* Measures every heap operation across sizes, key types & key distributions,
+* printing ns/op (and cache misses where the kernel allows perf counters)
+* and optionally writing the results as JSON to track regressions.
+*
+* Usage: bench [--min N] [--max N] [--json FILE]
+*   --min N     smallest size, a power of 10 (default 100)
+*   --max N     largest size, a power of 10 up to 100000000 (default 1000000)
+*   --json FILE write results to FILE as a JSON array
+*
+* @author Juan Arias
+*
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "maxheap.h"
+#include "daryheap.h"
+#include "heapsort.h"
+#include "topk.h"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Clock used for every measurement
+using Clock = std::chrono::steady_clock;
+
+// Items per pushBatch & popBatch call
+const int BATCH = 64;
+
+/*
+* A Payload is a 64-byte key, an 8-byte priority padded like a job record
+*/
+struct Payload {
+
+	long long key;
+	char padding[56];
+
+	bool operator<(const Payload& other) const { return this->key < other.key; }
+	bool operator<=(const Payload& other) const { return this->key <= other.key; }
+	bool operator>(const Payload& other) const { return this->key > other.key; }
+	bool operator==(const Payload& other) const { return this->key == other.key; }
+};
+
+/*
+* A Result is one measured operation, printed as a line and as a JSON object
+*/
+struct Result {
+
+	std::string heap, operation, type, distribution;
+	long long size, ops;
+	double nsPerOp;
+	long long cacheMisses;
+};
+
+/*
+* A CacheCounter counts last level cache misses of this thread with a perf
+* event, reporting -1 when perf events are unavailable
+*/
+class CacheCounter {
+
+public:
+
+	/*
+	* Opens the perf event
+	*/
+	CacheCounter() :fd(-1) {
+
+#ifdef __linux__
+		perf_event_attr attr;
+		std::memset(&attr, 0, sizeof(attr));
+
+		attr.type = PERF_TYPE_HARDWARE;
+		attr.size = sizeof(attr);
+		attr.config = PERF_COUNT_HW_CACHE_MISSES;
+		attr.disabled = 1;
+		attr.exclude_kernel = 1;
+		attr.exclude_hv = 1;
+
+		this->fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+	}
+
+	/*
+	* Closes the perf event
+	*/
+	~CacheCounter() {
+
+#ifdef __linux__
+		if (this->fd >= 0) {
+
+			close(this->fd);
+		}
+#endif
+	}
+
+	/*
+	* Resets & starts counting
+	*/
+	void start() {
+
+#ifdef __linux__
+		if (this->fd >= 0) {
+
+			ioctl(this->fd, PERF_EVENT_IOC_RESET, 0);
+			ioctl(this->fd, PERF_EVENT_IOC_ENABLE, 0);
+		}
+#endif
+	}
+
+	/*
+	* Stops counting
+	* @return the cache misses since start, -1 if unavailable
+	*/
+	long long stop() {
+
+		long long misses(-1);
+
+#ifdef __linux__
+		if (this->fd >= 0) {
+
+			ioctl(this->fd, PERF_EVENT_IOC_DISABLE, 0);
+
+			if (read(this->fd, &misses, sizeof(misses)) != sizeof(misses)) {
+
+				misses = -1;
+			}
+		}
+#endif
+
+		return misses;
+	}
+
+private:
+
+	// File descriptor of the perf event, -1 if unavailable
+	int fd;
+
+};
+
+/*
+* A Timer measures the time & cache misses of one operation
+*/
+class Timer {
+
+public:
+
+	/*
+	* Starts measuring
+	* @param counter The cache miss counter to use
+	*/
+	explicit Timer(CacheCounter& counter) :counter(counter) {
+
+		this->counter.start();
+		this->begin = Clock::now();
+	}
+
+	/*
+	* Stops measuring and stores the result
+	* @param result The result to fill in
+	* @param ops The number of operations measured
+	*/
+	void stop(Result& result, long long ops) {
+
+		std::chrono::duration<double, std::nano> elapsed = Clock::now() - this->begin;
+
+		result.cacheMisses = this->counter.stop();
+		result.ops = ops;
+		result.nsPerOp = (ops > 0) ? elapsed.count() / ops : 0.0;
+	}
+
+private:
+
+	CacheCounter& counter;
+	Clock::time_point begin;
+
+};
+
+/*
+* Converts a generated value into a key of each benchmarked type
+* @param value The generated value
+* @return the key
+*/
+template <class T>
+T makeKey(long long value);
+
+template <>
+int makeKey<int>(long long value) {
+
+	return static_cast<int>(value);
+}
+
+template <>
+double makeKey<double>(long long value) {
+
+	return value * 0.5;
+}
+
+template <>
+std::string makeKey<std::string>(long long value) {
+
+	char buffer[32];
+	std::snprintf(buffer, sizeof(buffer), "key-%012lld", value);
+
+	return buffer;
+}
+
+template <>
+Payload makeKey<Payload>(long long value) {
+
+	Payload payload;
+	payload.key = value;
+	std::memset(payload.padding, 0, sizeof(payload.padding));
+
+	return payload;
+}
+
+/*
+* Generates keys following the named distribution
+* @param distribution One of random, sorted, reverse & duplicates
+* @param size The number of keys
+* @return the keys
+*/
+template <class T>
+std::vector<T> generate(const std::string& distribution, long long size) {
+
+	std::mt19937_64 random(42);
+	std::vector<T> keys;
+
+	keys.reserve(size);
+
+	for (long long i(0); i < size; ++i) {
+
+		long long value;
+
+		if (distribution == "sorted") {
+
+			value = i;
+
+		} else if (distribution == "reverse") {
+
+			value = size - i;
+
+		} else if (distribution == "duplicates") {
+
+			value = static_cast<long long>(random() % 16);
+
+		} else {
+
+			value = static_cast<long long>(random() % 1000000000000LL);
+		}
+
+		keys.push_back(makeKey<T>(value));
+	}
+
+	return keys;
+}
+
+/*
+* Benchmarks every operation of one heap type on one key set
+* @param heapName The name of the heap under test
+* @param typeName The name of the key type
+* @param distribution The name of the key distribution
+* @param keys The keys to benchmark with
+* @param counter The cache miss counter to use
+* @param results The results to append to
+*/
+template <class HeapType, class T>
+void operations(const std::string& heapName, const std::string& typeName, const std::string& distribution,
+                const std::vector<T>& keys, CacheCounter& counter, std::vector<Result>& results) {
+
+	int size = static_cast<int>(keys.size());
+
+	Result result{heapName, "", typeName, distribution, size, 0, 0.0, -1};
+
+	HeapType heap;
+
+	{
+		result.operation = "push";
+		Timer timer(counter);
+
+		for (const T& key : keys) {
+
+			heap.add(key);
+		}
+
+		timer.stop(result, size);
+		results.push_back(result);
+	}
+
+	{
+		result.operation = "peek";
+		long long found(0);
+		Timer timer(counter);
+
+		for (int i(0); i < size; ++i) {
+
+			found += (heap.peek() == keys[i]);
+		}
+
+		timer.stop(result, size);
+		results.push_back(result);
+
+		// Keeps the loop from being optimized away
+		if (found < 0) {
+
+			std::cout << found;
+		}
+	}
+
+	{
+		result.operation = "contains";
+		int lookups = std::min(size, 100);
+		long long found(0);
+		Timer timer(counter);
+
+		for (int i(0); i < lookups; ++i) {
+
+			found += heap.contains(keys[(static_cast<long long>(i) * 7919) % size]);
+		}
+
+		timer.stop(result, lookups);
+		results.push_back(result);
+
+		if (found < 0) {
+
+			std::cout << found;
+		}
+	}
+
+	{
+		result.operation = "copy";
+		Timer timer(counter);
+
+		HeapType copy(heap);
+
+		timer.stop(result, 1);
+		results.push_back(result);
+	}
+
+	{
+		result.operation = "assign";
+		HeapType copy;
+		Timer timer(counter);
+
+		copy = heap;
+
+		timer.stop(result, 1);
+		results.push_back(result);
+	}
+
+	{
+		result.operation = "pop";
+		Timer timer(counter);
+
+		while (!heap.isEmpty()) {
+
+			heap.remove();
+		}
+
+		timer.stop(result, size);
+		results.push_back(result);
+	}
+
+	{
+		result.operation = "pushBatch";
+		HeapType batched;
+		Timer timer(counter);
+
+		for (int i(0); i < size; i += BATCH) {
+
+			batched.pushBatch(keys.data() + i, std::min(BATCH, size - i));
+		}
+
+		timer.stop(result, size);
+		results.push_back(result);
+
+		result.operation = "popBatch";
+		std::vector<T> out(BATCH);
+		Timer popTimer(counter);
+
+		while (batched.popBatch(BATCH, out.data()) > 0) {}
+
+		popTimer.stop(result, size);
+		results.push_back(result);
+	}
+
+	{
+		result.operation = "heapify";
+		Timer timer(counter);
+
+		HeapType built(keys.data(), size);
+
+		timer.stop(result, size);
+		results.push_back(result);
+	}
+
+	{
+		result.operation = "maxHeapSort";
+		std::vector<T> copy(keys);
+		Timer timer(counter);
+
+		HeapType::maxHeapSort(copy.data(), size);
+
+		timer.stop(result, size);
+		results.push_back(result);
+	}
+}
+
+/*
+* Benchmarks the standard library sorts the heap sorts compete with
+* @param typeName The name of the key type
+* @param distribution The name of the key distribution
+* @param keys The keys to benchmark with
+* @param counter The cache miss counter to use
+* @param results The results to append to
+*/
+template <class T>
+void sorts(const std::string& typeName, const std::string& distribution, const std::vector<T>& keys,
+           CacheCounter& counter, std::vector<Result>& results) {
+
+	int size = static_cast<int>(keys.size());
+	int top = std::max(size / 100, 1);
+
+	Result result{"sort", "", typeName, distribution, size, 0, 0.0, -1};
+
+	std::vector<T> copy(keys);
+
+	{
+		result.operation = "std::sort";
+		Timer timer(counter);
+
+		std::sort(copy.begin(), copy.end());
+
+		timer.stop(result, size);
+		results.push_back(result);
+	}
+
+	copy = keys;
+
+	{
+		result.operation = "heapSort";
+		Timer timer(counter);
+
+		heapSort(copy.begin(), copy.end());
+
+		timer.stop(result, size);
+		results.push_back(result);
+	}
+
+	copy = keys;
+
+	{
+		result.operation = "std::partial_sort";
+		Timer timer(counter);
+
+		std::partial_sort(copy.begin(), copy.begin() + top, copy.end());
+
+		timer.stop(result, size);
+		results.push_back(result);
+	}
+
+	copy = keys;
+
+	{
+		result.operation = "partialSortTopK";
+		Timer timer(counter);
+
+		partialSortTopK(copy.begin(), copy.begin() + top, copy.end());
+
+		timer.stop(result, size);
+		results.push_back(result);
+	}
+
+	{
+		result.operation = "TopK";
+		Timer timer(counter);
+
+		TopK<T> best(top);
+		best.addRange(keys.begin(), keys.end());
+
+		timer.stop(result, size);
+		results.push_back(result);
+	}
+}
+
+/*
+* Benchmarks every heap on every distribution of one key type
+* @param typeName The name of the key type
+* @param size The number of keys
+* @param counter The cache miss counter to use
+* @param results The results to append to
+*/
+template <class T>
+void keyType(const std::string& typeName, long long size, CacheCounter& counter, std::vector<Result>& results) {
+
+	for (const char* distribution : {"random", "sorted", "reverse", "duplicates"}) {
+
+		std::vector<T> keys = generate<T>(distribution, size);
+
+		operations<MaxHeap<T>>("MaxHeap", typeName, distribution, keys, counter, results);
+		operations<DaryHeap<T, 4>>("DaryHeap<4>", typeName, distribution, keys, counter, results);
+		operations<DaryHeap<T, 8>>("DaryHeap<8>", typeName, distribution, keys, counter, results);
+
+		sorts(typeName, distribution, keys, counter, results);
+	}
+}
+
+/*
+* Prints one result as a line of text
+* @param result The result to print
+*/
+void print(const Result& result) {
+
+	std::cout << result.heap << "\t" << result.operation << "\t" << result.type << "\t"
+	          << result.distribution << "\t" << result.size << "\t" << result.nsPerOp << " ns/op";
+
+	if (result.cacheMisses >= 0) {
+
+		std::cout << "\t" << result.cacheMisses << " misses";
+	}
+
+	std::cout << std::endl;
+}
+
+/*
+* Writes every result to a file as a JSON array
+* @param path The path of the file
+* @param results The results to write
+*/
+void writeJson(const std::string& path, const std::vector<Result>& results) {
+
+	std::ofstream out(path);
+
+	out << "[\n";
+
+	for (std::size_t i(0); i < results.size(); ++i) {
+
+		const Result& result = results[i];
+
+		out << "  {\"heap\": \"" << result.heap << "\", \"operation\": \"" << result.operation
+		    << "\", \"type\": \"" << result.type << "\", \"distribution\": \"" << result.distribution
+		    << "\", \"size\": " << result.size << ", \"ops\": " << result.ops
+		    << ", \"ns_per_op\": " << result.nsPerOp << ", \"cache_misses\": ";
+
+		if (result.cacheMisses >= 0) {
+
+			out << result.cacheMisses;
+
+		} else {
+
+			out << "null";
+		}
+
+		out << ((i + 1 < results.size()) ? "},\n" : "}\n");
+	}
+
+	out << "]\n";
+}
+
+/*
+* Runs the benchmark suite
+* @param argc The number of arguments
+* @param argv The arguments, see the usage at the top of this file
+*/
+int main(int argc, char* argv[]) {
+
+	long long minSize(100), maxSize(1000000);
+	std::string json;
+
+	for (int i(1); i + 1 < argc; i += 2) {
+
+		std::string flag(argv[i]);
+
+		if (flag == "--min") {
+
+			minSize = std::atoll(argv[i + 1]);
+
+		} else if (flag == "--max") {
+
+			maxSize = std::min(std::atoll(argv[i + 1]), 100000000LL);
+
+		} else if (flag == "--json") {
+
+			json = argv[i + 1];
+		}
+	}
+
+	CacheCounter counter;
+	std::vector<Result> results;
+
+	for (long long size(minSize); size <= maxSize; size *= 10) {
+
+		std::size_t first = results.size();
+
+		keyType<int>("int", size, counter, results);
+		keyType<double>("double", size, counter, results);
+		keyType<std::string>("string", size, counter, results);
+		keyType<Payload>("payload64", size, counter, results);
+
+		for (std::size_t i(first); i < results.size(); ++i) {
+
+			print(results[i]);
+		}
+	}
+
+	if (!json.empty()) {
+
+		writeJson(json, results);
+	}
+}
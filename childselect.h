@@ -0,0 +1,102 @@
+/*
+* childselect.h
+*
+* Specifications for ChildSelect & Simd classes
+*
+* @author Juan Arias
+*
+*/
+
+#ifndef CHILDSELECT_H
+#define CHILDSELECT_H
+
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+// SIMD kernels are compiled with per-function target attributes,
+// define HEAP_NO_SIMD to always use the scalar compare chain
+#if !defined(HEAP_NO_SIMD) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define HEAP_SIMD
+#endif
+
+/*
+* Simd holds the vectorized kernels finding the greatest (or least) of 4 or 8
+* adjacent keys, and picks the widest instruction set the CPU supports at runtime.
+*/
+class Simd {
+
+public:
+
+	// Instruction sets the kernels can be dispatched to
+	enum Level { SCALAR, SSE42, AVX2 };
+
+	/*
+	* Static method
+	* Checks if a group of D children of type T ordered by Compare has a kernel
+	* @return true if vectorized, else false
+	*/
+	template <class T, int D, class Compare>
+	static constexpr bool supports();
+
+	/*
+	* Static method
+	* Gets the widest instruction set of this CPU, detected once
+	* @return the instruction set level
+	*/
+	static Level level();
+
+	/*
+	* Static method
+	* Gets the index of the first greatest (or least) key in a group
+	* @param keys The group of keys
+	* @param count The number of keys, 4 or 8
+	* @return the index of the selected key, -1 if it cannot be selected (NaN keys)
+	*/
+	template <bool GREATEST, class T>
+	static int select(const T keys[], int count);
+
+};
+
+/*
+* ChildSelect finds the larger of a full group of D children. The primary
+* template is a scalar compare chain, the specialization uses Simd kernels
+* for groups of 8 arithmetic keys ordered by std::less or std::greater.
+*/
+template <class T, int D, class Compare, class Enable = void>
+class ChildSelect {
+
+public:
+
+	/*
+	* Static method
+	* Gets the larger of a group of D children
+	* @param children The first of D adjacent children
+	* @param comp The comparator deciding which child is larger
+	* @return the offset of the larger child from the first
+	*/
+	static int larger(const T children[], const Compare& comp);
+
+};
+
+/*
+* Specialization of ChildSelect for groups with a Simd kernel
+*/
+template <class T, int D, class Compare>
+class ChildSelect<T, D, Compare, typename std::enable_if<Simd::supports<T, D, Compare>()>::type> {
+
+public:
+
+	/*
+	* Static method
+	* Gets the larger of a group of D children
+	* @param children The first of D adjacent children
+	* @param comp The comparator deciding which child is larger
+	* @return the offset of the larger child from the first
+	*/
+	static int larger(const T children[], const Compare& comp);
+
+};
+
+#include "childselect.cpp"
+#endif // CHILDSELECT_H
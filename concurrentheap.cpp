@@ -0,0 +1,386 @@
+#include "concurrentheap.h"
+/*
+* concurrentheap.cpp
+*
+* Implementations for ConcurrentHeap class
+*
+* @author Juan Arias
+*
+*/
+
+#include <algorithm>
+#include <cstdint>
+
+  //**************// //**************// //**************//
+ //*  PUBLIC:   *// //*  PUBLIC:   *// //*  PUBLIC:   *//
+//**************// //**************// //**************//
+
+/*
+* Constructs empty heap
+* @param threads The number of threads expected to share the heap
+* @param relaxation The number of shards per thread, 1 or more
+* @param comp The comparator to order the heap by
+*/
+template <class T, class Compare>
+ConcurrentHeap<T, Compare>::ConcurrentHeap(int threads, int relaxation, const Compare& comp)
+	:count(std::max(threads, 1) * std::max(relaxation, 1)), comp(comp), items(0), waiters(0) {
+
+	this->shards.reset(new Shard[this->count]);
+
+	for (int i(0); i < this->count; ++i) {
+
+		this->shards[i].heap = BasicHeap<T, Compare>(comp);
+	}
+}
+
+/*
+* Destroys heap and deallocates all dynamic memory
+*/
+template <class T, class Compare>
+ConcurrentHeap<T, Compare>::~ConcurrentHeap() {}
+
+/*
+* Add item to the heap, waiting for a shard's lock if all are contended
+* @param item The item to add to the heap
+*/
+template <class T, class Compare>
+void ConcurrentHeap<T, Compare>::push(const T& item) {
+
+	this->insert(item, true);
+}
+
+/*
+* Add item to the heap by moving it, waiting for a shard's lock if all are contended
+* @param item The item to move into the heap
+*/
+template <class T, class Compare>
+void ConcurrentHeap<T, Compare>::push(T&& item) {
+
+	this->insert(std::move(item), true);
+}
+
+/*
+* Add item to the heap without waiting for a lock
+* @param item The item to add to the heap
+* @return true if added, false if every shard was locked
+*/
+template <class T, class Compare>
+bool ConcurrentHeap<T, Compare>::tryPush(const T& item) {
+
+	return this->insert(item, false);
+}
+
+/*
+* Remove a high priority item without waiting for one to be added
+* @param item Set to the removed item
+* @return true if removed, false if the heap was empty
+*/
+template <class T, class Compare>
+bool ConcurrentHeap<T, Compare>::tryPop(T& item) {
+
+	return this->take(1, &item) == 1;
+}
+
+/*
+* Add every item in the array to one shard under a single lock
+* @param items The array of items to add
+* @param count The number of items
+*/
+template <class T, class Compare>
+void ConcurrentHeap<T, Compare>::pushBatch(const T items[], int count) {
+
+	if (count <= 0) {
+
+		return;
+	}
+
+	int start = ConcurrentHeap::randomShard(this->count);
+	Shard* shard = nullptr;
+
+	std::unique_lock<std::mutex> lock;
+
+	for (int i(0); i < this->count && shard == nullptr; ++i) {
+
+		lock = std::unique_lock<std::mutex>(this->shards[(start + i) % this->count].lock, std::try_to_lock);
+
+		if (lock.owns_lock()) {
+
+			shard = &this->shards[(start + i) % this->count];
+		}
+	}
+
+	if (shard == nullptr) {
+
+		shard = &this->shards[start];
+		lock = std::unique_lock<std::mutex>(shard->lock);
+	}
+
+	shard->heap.pushBatch(items, count);
+	lock.unlock();
+
+	this->notify(count);
+}
+
+/*
+* Remove up to count high priority items without waiting for more to be added,
+* taking each batch from the better of two random shards under a single lock
+* @param count The number of items to remove
+* @param out The array to move the removed items into
+* @return the number of items removed, fewer than count if the heap empties
+*/
+template <class T, class Compare>
+int ConcurrentHeap<T, Compare>::popBatch(int count, T out[]) {
+
+	int removed(0);
+
+	while (removed < count) {
+
+		int taken = this->take(count - removed, out + removed);
+
+		if (taken == 0) {
+
+			break;
+		}
+
+		removed += taken;
+	}
+
+	return removed;
+}
+
+/*
+* Remove a high priority item, waiting until one is added if empty
+* @return the removed item
+*/
+template <class T, class Compare>
+T ConcurrentHeap<T, Compare>::pop() {
+
+	T item;
+
+	while (!this->tryPop(item)) {
+
+		std::unique_lock<std::mutex> lock(this->waitLock);
+
+		++this->waiters;
+
+		this->added.wait(lock, [this] { return this->items.load() > 0; });
+
+		--this->waiters;
+	}
+
+	return item;
+}
+
+/*
+* Gets the number of items, exact only when no thread is adding or removing
+* @return the number of items
+*/
+template <class T, class Compare>
+int ConcurrentHeap<T, Compare>::size() const {
+
+	return std::max(this->items.load(), 0);
+}
+
+/*
+* Check if the heap is empty, exact only when no thread is adding or removing
+* @return true if empty, else false
+*/
+template <class T, class Compare>
+bool ConcurrentHeap<T, Compare>::isEmpty() const {
+
+	return this->size() == 0;
+}
+
+/*
+* Gets the number of shards
+* @return the number of shards
+*/
+template <class T, class Compare>
+int ConcurrentHeap<T, Compare>::getShards() const {
+
+	return this->count;
+}
+
+  //**************// //**************// //**************//
+ //*  PRIVATE:  *// //*  PRIVATE:  *// //*  PRIVATE:  *//
+//**************// //**************// //**************//
+
+/*
+* Static method
+* Gets the number of hardware threads
+* @return the number of hardware threads, 1 if unknown
+*/
+template <class T, class Compare>
+int ConcurrentHeap<T, Compare>::hardwareThreads() {
+
+	return std::max(static_cast<int>(std::thread::hardware_concurrency()), 1);
+}
+
+/*
+* Static method
+* Gets a random shard for the calling thread
+* @param count The number of shards
+* @return the index of the shard
+*/
+template <class T, class Compare>
+int ConcurrentHeap<T, Compare>::randomShard(int count) {
+
+	// xorshift, seeded by the address of the thread's own state
+	thread_local std::uint32_t state(0);
+
+	if (state == 0) {
+
+		state = static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(&state) >> 4) | 1;
+	}
+
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+
+	return static_cast<int>(state % static_cast<std::uint32_t>(count));
+}
+
+/*
+* Adds item to a shard, locking the first uncontended one of a random probe
+* @param item The item to add, forwarded into the shard
+* @param wait If true lock a shard when every one probed is contended
+* @return true if added, else false
+*/
+template <class T, class Compare>
+template <class Item>
+bool ConcurrentHeap<T, Compare>::insert(Item&& item, bool wait) {
+
+	int start = ConcurrentHeap::randomShard(this->count);
+
+	for (int i(0); i < this->count; ++i) {
+
+		Shard& shard = this->shards[(start + i) % this->count];
+
+		std::unique_lock<std::mutex> lock(shard.lock, std::try_to_lock);
+
+		if (lock.owns_lock()) {
+
+			shard.heap.add(std::forward<Item>(item));
+			lock.unlock();
+
+			this->notify();
+
+			return true;
+		}
+	}
+
+	if (wait) {
+
+		Shard& shard = this->shards[start];
+
+		{
+			std::lock_guard<std::mutex> lock(shard.lock);
+			shard.heap.add(std::forward<Item>(item));
+		}
+
+		this->notify();
+	}
+
+	return wait;
+}
+
+/*
+* Removes up to count peek items of the better of two random shards,
+* locking every shard in turn when few items are left or under contention
+* @param count The number of items to remove, 1 or more
+* @param out The array to move the removed items into
+* @return the number of items removed, 0 if the heap was empty
+*/
+template <class T, class Compare>
+int ConcurrentHeap<T, Compare>::take(int count, T out[]) {
+
+	// Two random choices per attempt, before falling back to a scan
+	for (int attempt(0); attempt < this->count && this->items.load() > 0; ++attempt) {
+
+		Shard& first = this->shards[ConcurrentHeap::randomShard(this->count)];
+		Shard& second = this->shards[ConcurrentHeap::randomShard(this->count)];
+
+		std::unique_lock<std::mutex> firstLock(first.lock, std::try_to_lock);
+
+		if (!firstLock.owns_lock()) {
+
+			continue;
+		}
+
+		Shard* best = first.heap.isEmpty() ? nullptr : &first;
+
+		std::unique_lock<std::mutex> secondLock;
+
+		if (&second != &first) {
+
+			secondLock = std::unique_lock<std::mutex>(second.lock, std::try_to_lock);
+
+			if (secondLock.owns_lock() && !second.heap.isEmpty()
+			    && (best == nullptr || this->comp(best->heap.peek(), second.heap.peek()))) {
+
+				best = &second;
+			}
+		}
+
+		if (best != nullptr) {
+
+			return this->take(*best, count, out);
+		}
+	}
+
+	// Few items or heavy contention, lock every shard in turn
+	for (int i(0); i < this->count && this->items.load() > 0; ++i) {
+
+		Shard& shard = this->shards[i];
+
+		std::lock_guard<std::mutex> lock(shard.lock);
+
+		if (!shard.heap.isEmpty()) {
+
+			return this->take(shard, count, out);
+		}
+	}
+
+	return 0;
+}
+
+/*
+* Removes up to count peek items of a locked shard
+* @param shard The locked shard, not empty
+* @param count The number of items to remove, 1 or more
+* @param out The array to move the removed items into
+* @return the number of items removed
+*/
+template <class T, class Compare>
+int ConcurrentHeap<T, Compare>::take(Shard& shard, int count, T out[]) {
+
+	int taken = shard.heap.popBatch(count, out);
+
+	this->items -= taken;
+
+	return taken;
+}
+
+/*
+* Counts added items and wakes threads blocked in pop
+* @param pushed The number of items added
+*/
+template <class T, class Compare>
+void ConcurrentHeap<T, Compare>::notify(int pushed) {
+
+	this->items += pushed;
+
+	if (this->waiters.load() > 0) {
+
+		std::lock_guard<std::mutex> lock(this->waitLock);
+
+		if (pushed > 1) {
+
+			this->added.notify_all();
+
+		} else {
+
+			this->added.notify_one();
+		}
+	}
+}
@@ -0,0 +1,196 @@
+/*
+* concurrentheap.h
+*
+* Specifications for ConcurrentHeap class
+*
+* @author Juan Arias
+*
+*/
+
+#ifndef CONCURRENTHEAP_H
+#define CONCURRENTHEAP_H
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include "basicheap.h"
+
+/*
+* A ConcurrentHeap is a relaxed priority queue safe to share between threads,
+* built as a MultiQueue: items are spread over shards, each a BasicHeap behind
+* its own lock, and pop takes the better top of two random shards. Pops may
+* return an item of lower priority than the true peek, by a rank that grows
+* with the number of shards (threads * relaxation) but not with the size.
+*/
+template <class T, class Compare = std::less<T>>
+class ConcurrentHeap {
+
+public:
+
+	/*
+	* Constructs empty heap
+	* @param threads The number of threads expected to share the heap
+	* @param relaxation The number of shards per thread, 1 or more
+	* @param comp The comparator to order the heap by
+	*/
+	explicit ConcurrentHeap(int threads = ConcurrentHeap::hardwareThreads(), int relaxation = RELAXATION,
+	                        const Compare& comp = Compare());
+
+	ConcurrentHeap(const ConcurrentHeap& other) = delete;
+	ConcurrentHeap& operator=(const ConcurrentHeap& other) = delete;
+
+	/*
+	* Destroys heap and deallocates all dynamic memory
+	*/
+	~ConcurrentHeap();
+
+	/*
+	* Add item to the heap, waiting for a shard's lock if all are contended
+	* @param item The item to add to the heap
+	*/
+	void push(const T& item);
+
+	/*
+	* Add item to the heap by moving it, waiting for a shard's lock if all are contended
+	* @param item The item to move into the heap
+	*/
+	void push(T&& item);
+
+	/*
+	* Add item to the heap without waiting for a lock
+	* @param item The item to add to the heap
+	* @return true if added, false if every shard was locked
+	*/
+	bool tryPush(const T& item);
+
+	/*
+	* Remove a high priority item without waiting for one to be added
+	* @param item Set to the removed item
+	* @return true if removed, false if the heap was empty
+	*/
+	bool tryPop(T& item);
+
+	/*
+	* Add every item in the array to one shard under a single lock
+	* @param items The array of items to add
+	* @param count The number of items
+	*/
+	void pushBatch(const T items[], int count);
+
+	/*
+	* Remove up to count high priority items without waiting for more to be added,
+	* taking each batch from the better of two random shards under a single lock
+	* @param count The number of items to remove
+	* @param out The array to move the removed items into
+	* @return the number of items removed, fewer than count if the heap empties
+	*/
+	int popBatch(int count, T out[]);
+
+	/*
+	* Remove a high priority item, waiting until one is added if empty
+	* @return the removed item
+	*/
+	T pop();
+
+	/*
+	* Gets the number of items, exact only when no thread is adding or removing
+	* @return the number of items
+	*/
+	int size() const;
+
+	/*
+	* Check if the heap is empty, exact only when no thread is adding or removing
+	* @return true if empty, else false
+	*/
+	bool isEmpty() const;
+
+	/*
+	* Gets the number of shards
+	* @return the number of shards
+	*/
+	int getShards() const;
+
+private:
+
+	// Constant for size of a cache line shards are aligned to
+	static const int CACHE_LINE = 64;
+
+	// One BasicHeap & its lock, on its own cache lines
+	struct alignas(CACHE_LINE) Shard {
+
+		std::mutex lock;
+		BasicHeap<T, Compare> heap;
+	};
+
+	// Shards of the heap
+	std::unique_ptr<Shard[]> shards;
+	int count;
+
+	// Comparator ordering the heap, comp(a, b) is true if b has priority
+	Compare comp;
+
+	// Number of items, incremented after an add & decremented after a remove
+	alignas(CACHE_LINE) std::atomic<int> items;
+
+	// Threads blocked in pop, woken by adds
+	std::atomic<int> waiters;
+	std::mutex waitLock;
+	std::condition_variable added;
+
+	// Constant for default shards per thread
+	static const int RELAXATION = 2;
+
+	/*
+	* Static method
+	* Gets the number of hardware threads
+	* @return the number of hardware threads, 1 if unknown
+	*/
+	static int hardwareThreads();
+
+	/*
+	* Static method
+	* Gets a random shard for the calling thread
+	* @param count The number of shards
+	* @return the index of the shard
+	*/
+	static int randomShard(int count);
+
+	/*
+	* Adds item to a shard, locking the first uncontended one of a random probe
+	* @param item The item to add, forwarded into the shard
+	* @param wait If true lock a shard when every one probed is contended
+	* @return true if added, else false
+	*/
+	template <class Item>
+	bool insert(Item&& item, bool wait);
+
+	/*
+	* Removes up to count peek items of the better of two random shards,
+	* locking every shard in turn when few items are left or under contention
+	* @param count The number of items to remove, 1 or more
+	* @param out The array to move the removed items into
+	* @return the number of items removed, 0 if the heap was empty
+	*/
+	int take(int count, T out[]);
+
+	/*
+	* Removes up to count peek items of a locked shard
+	* @param shard The locked shard, not empty
+	* @param count The number of items to remove, 1 or more
+	* @param out The array to move the removed items into
+	* @return the number of items removed
+	*/
+	int take(Shard& shard, int count, T out[]);
+
+	/*
+	* Counts added items and wakes threads blocked in pop
+	* @param pushed The number of items added
+	*/
+	void notify(int pushed = 1);
+
+};
+#include "concurrentheap.cpp"
+#endif // CONCURRENTHEAP_H
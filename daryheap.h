@@ -0,0 +1,25 @@
+/*
+* daryheap.h
+* 
+* Specifications for DaryHeap class
+*
+* @author Juan Arias
+*
+*/
+
+#ifndef DARYHEAP_H
+#define DARYHEAP_H
+
+#include <functional>
+#include "basicheap.h"
+
+/*
+* A DaryHeap is an implementation of the Heap interface where every node has
+* D children, which are stored on one cache line when D * sizeof(T) is 64.
+* Wider nodes make the heap shallower, so removing the peek item touches
+* fewer cache lines than in a binary heap.
+*/
+template <class T, int D, class Compare = std::less<T>>
+using DaryHeap = BasicHeap<T, Compare, Heap<T>, D>;
+
+#endif // DARYHEAP_H
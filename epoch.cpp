@@ -0,0 +1,221 @@
+/*
+* epoch.cpp
+*
+* Implementations for Epoch class
+*
+* @author Juan Arias
+*
+*/
+
+#include "epoch.h"
+
+  //**************// //**************// //**************//
+ //*  PUBLIC:   *// //*  PUBLIC:   *// //*  PUBLIC:   *//
+//**************// //**************// //**************//
+
+/*
+* Enters the current epoch
+*/
+inline Epoch::Guard::Guard() {
+
+	Record& record = Epoch::record();
+
+	if (record.depth++ == 0) {
+
+		// Announcing a stale epoch is safe, it only holds back the next advance
+		record.epoch.store(Epoch::registry().epoch.load());
+	}
+}
+
+/*
+* Leaves the epoch entered
+*/
+inline Epoch::Guard::~Guard() {
+
+	Record& record = Epoch::record();
+
+	if (--record.depth == 0) {
+
+		record.epoch.store(Epoch::QUIESCENT, std::memory_order_release);
+	}
+}
+
+/*
+* Static method
+* Retires a node unlinked from a shared structure, destroying it once no
+* thread can still hold it
+* @param node The node to retire
+* @param destroy The function destroying the node
+*/
+inline void Epoch::retire(void* node, void (*destroy)(void*)) {
+
+	Record& record = Epoch::record();
+
+	record.retired.push_back(Retired{node, destroy, Epoch::registry().epoch.load()});
+
+	if (record.retired.size() % Epoch::COLLECT == 0) {
+
+		Epoch::collect();
+	}
+}
+
+/*
+* Static method
+* Advances the epoch if possible and destroys the calling thread's nodes
+* no thread can still hold
+*/
+inline void Epoch::collect() {
+
+	Epoch::advance();
+
+	Epoch::reclaim(Epoch::record(), Epoch::registry().epoch.load());
+}
+
+  //**************// //**************// //**************//
+ //*  PRIVATE:  *// //*  PRIVATE:  *// //*  PRIVATE:  *//
+//**************// //**************// //**************//
+
+/*
+* Constructs registry in the first epoch
+*/
+inline Epoch::Registry::Registry() :epoch(Epoch::QUIESCENT + 1), records(nullptr) {}
+
+/*
+* Destroys every record & every node still retired, at process exit
+*/
+inline Epoch::Registry::~Registry() {
+
+	Record* curr = this->records.load();
+
+	while (curr != nullptr) {
+
+		Record* next = curr->next;
+
+		for (Retired& retired : curr->retired) {
+
+			retired.destroy(retired.node);
+		}
+
+		delete curr;
+		curr = next;
+	}
+}
+
+/*
+* Acquires a free record or registers a new one
+*/
+inline Epoch::Owner::Owner() :record(nullptr) {
+
+	Registry& registry = Epoch::registry();
+
+	for (Record* curr = registry.records.load(); curr != nullptr && this->record == nullptr; curr = curr->next) {
+
+		bool used(false);
+
+		if (curr->used.compare_exchange_strong(used, true)) {
+
+			this->record = curr;
+		}
+	}
+
+	if (this->record == nullptr) {
+
+		Record* created = new Record();
+
+		created->epoch.store(Epoch::QUIESCENT);
+		created->used.store(true);
+		created->depth = 0;
+		created->next = registry.records.load();
+
+		while (!registry.records.compare_exchange_weak(created->next, created)) {}
+
+		this->record = created;
+	}
+}
+
+/*
+* Releases the record, its retired nodes are reclaimed by its next owner
+*/
+inline Epoch::Owner::~Owner() {
+
+	Epoch::reclaim(*this->record, Epoch::registry().epoch.load());
+
+	this->record->used.store(false, std::memory_order_release);
+}
+
+/*
+* Static method
+* Gets the registry of the process
+* @return the registry
+*/
+inline Epoch::Registry& Epoch::registry() {
+
+	static Registry registry;
+
+	return registry;
+}
+
+/*
+* Static method
+* Gets the record of the calling thread
+* @return the record
+*/
+inline Epoch::Record& Epoch::record() {
+
+	// Constructs the registry first so it outlives every thread's owner
+	Epoch::registry();
+
+	thread_local Owner owner;
+
+	return *owner.record;
+}
+
+/*
+* Static method
+* Advances the global epoch if every thread holding a guard is in it
+*/
+inline void Epoch::advance() {
+
+	Registry& registry = Epoch::registry();
+
+	std::uint64_t epoch = registry.epoch.load();
+
+	for (Record* curr = registry.records.load(); curr != nullptr; curr = curr->next) {
+
+		std::uint64_t announced = curr->epoch.load();
+
+		if (announced != Epoch::QUIESCENT && announced != epoch) {
+
+			return;
+		}
+	}
+
+	registry.epoch.compare_exchange_strong(epoch, epoch + 1);
+}
+
+/*
+* Static method
+* Destroys the nodes of the given record retired two or more epochs ago
+* @param record The record to reclaim nodes of
+* @param epoch The global epoch
+*/
+inline void Epoch::reclaim(Record& record, std::uint64_t epoch) {
+
+	std::size_t kept(0);
+
+	for (std::size_t i(0); i < record.retired.size(); ++i) {
+
+		Retired& retired = record.retired[i];
+
+		if (retired.epoch + 2 <= epoch) {
+
+			retired.destroy(retired.node);
+
+		} else {
+
+			record.retired[kept++] = retired;
+		}
+	}
+
+	record.retired.resize(kept);
+}
@@ -0,0 +1,141 @@
+/*
+* epoch.h
+*
+* Specifications for Epoch class
+*
+* @author Juan Arias
+*
+*/
+
+#ifndef EPOCH_H
+#define EPOCH_H
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+/*
+* Epoch is a process wide epoch-based reclamation domain for lock-free
+* structures. Threads hold a Guard while they may dereference shared nodes,
+* and a node unlinked from a structure is retired instead of deleted; it is
+* destroyed once every thread has left the epoch it was retired in.
+*/
+class Epoch {
+
+public:
+
+	/*
+	* A Guard pins the calling thread to the current epoch while in scope,
+	* guards may nest
+	*/
+	class Guard {
+
+	public:
+
+		/*
+		* Enters the current epoch
+		*/
+		Guard();
+
+		Guard(const Guard& other) = delete;
+		Guard& operator=(const Guard& other) = delete;
+
+		/*
+		* Leaves the epoch entered
+		*/
+		~Guard();
+
+	};
+
+	/*
+	* Static method
+	* Retires a node unlinked from a shared structure, destroying it once no
+	* thread can still hold it
+	* @param node The node to retire
+	* @param destroy The function destroying the node
+	*/
+	static void retire(void* node, void (*destroy)(void*));
+
+	/*
+	* Static method
+	* Advances the epoch if possible and destroys the calling thread's nodes
+	* no thread can still hold
+	*/
+	static void collect();
+
+private:
+
+	// A node waiting to be destroyed
+	struct Retired {
+
+		void* node;
+		void (*destroy)(void*);
+		std::uint64_t epoch;
+	};
+
+	// Epoch announced by one thread & the nodes it retired, on its own cache line
+	struct alignas(64) Record {
+
+		std::atomic<std::uint64_t> epoch;
+		std::atomic<bool> used;
+		int depth;
+		std::vector<Retired> retired;
+		Record* next;
+	};
+
+	// Every record, reused by later threads once their thread exits
+	struct Registry {
+
+		std::atomic<std::uint64_t> epoch;
+		std::atomic<Record*> records;
+
+		Registry();
+		~Registry();
+	};
+
+	// The record of the calling thread, released when the thread exits
+	struct Owner {
+
+		Record* record;
+
+		Owner();
+		~Owner();
+	};
+
+	// Constant for the epoch of a thread holding no guard
+	static const std::uint64_t QUIESCENT = 0;
+
+	// Constant for nodes retired between attempts to collect
+	static const int COLLECT = 64;
+
+	/*
+	* Static method
+	* Gets the registry of the process
+	* @return the registry
+	*/
+	static Registry& registry();
+
+	/*
+	* Static method
+	* Gets the record of the calling thread
+	* @return the record
+	*/
+	static Record& record();
+
+	/*
+	* Static method
+	* Advances the global epoch if every thread holding a guard is in it
+	*/
+	static void advance();
+
+	/*
+	* Static method
+	* Destroys the nodes of the given record retired two or more epochs ago
+	* @param record The record to reclaim nodes of
+	* @param epoch The global epoch
+	*/
+	static void reclaim(Record& record, std::uint64_t epoch);
+
+};
+#include "epoch.cpp"
+#endif // EPOCH_H
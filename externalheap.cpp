@@ -0,0 +1,489 @@
+#include "externalheap.h"
+/*
+* externalheap.cpp
+*
+* Implementations for ExternalHeap class
+*
+* @author Juan Arias
+*
+*/
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstdint>
+#include <numeric>
+#include <system_error>
+#include <utility>
+
+  //**************// //**************// //**************//
+ //*  PUBLIC:   *// //*  PUBLIC:   *// //*  PUBLIC:   *//
+//**************// //**************// //**************//
+
+/*
+* Constructs empty heap
+* @param memory The memory budget in bytes, for the hot heap & run blocks
+* @param block The size in bytes of each read from or write to a run
+* @param directory The directory runs are written to
+* @param comp The comparator to order the heap by
+*/
+template <class T, class Compare>
+ExternalHeap<T, Compare>::ExternalHeap(std::size_t memory, std::size_t block,
+                                       const std::string& directory, const Compare& comp)
+	:hot(comp), heads(HeadCompare{comp}), directory(directory), created(0), spilled(0), comp(comp) {
+
+	std::size_t items = std::min<std::size_t>(memory / 2 / sizeof(T), INT_MAX);
+	std::size_t perBlock = std::min<std::size_t>(block / sizeof(T), INT_MAX);
+
+	this->limit = std::max(static_cast<int>(items), 1);
+	this->blockItems = std::max(static_cast<int>(perBlock), 1);
+
+	std::size_t blocks = memory / 2 / (sizeof(T) * this->blockItems);
+
+	// At least 4, so merging half the runs merges 2 or more
+	this->maxRuns = std::max(static_cast<int>(std::min<std::size_t>(blocks, INT_MAX)), 4);
+}
+
+/*
+* Destroys heap, closing & deleting every run
+*/
+template <class T, class Compare>
+ExternalHeap<T, Compare>::~ExternalHeap() {
+
+	this->clear();
+}
+
+/*
+* Add item to the heap, spilling the hot heap to a run if full. If the
+* spill fails, the heap is left as it was & the error thrown
+* @param item The item to add to the heap
+*/
+template <class T, class Compare>
+void ExternalHeap<T, Compare>::add(const T& item) {
+
+	if (this->hot.getNodes() == this->limit) {
+
+		this->spill();
+	}
+
+	// Grows straight to the limit rather than past it
+	if (this->hot.getNodes() == this->hot.getCapacity()
+	    && this->hot.getCapacity() * this->hot.getGrowthFactor() > this->limit) {
+
+		this->hot.reserve(this->limit);
+	}
+
+	this->hot.add(item);
+}
+
+/*
+* Remove the peek item in the heap and return it
+* @return the peek item
+*/
+template <class T, class Compare>
+T ExternalHeap<T, Compare>::pop() {
+
+	if (!this->heads.isEmpty() && (this->hot.isEmpty() || this->comp(this->hot.peek(), this->heads.peek().item))) {
+
+		return this->take();
+	}
+
+	if (this->hot.isEmpty()) {
+
+		throw ExternalHeap::EMPTY;
+	}
+
+	return this->hot.pop();
+}
+
+/*
+* Remove the peek item in the heap
+*/
+template <class T, class Compare>
+void ExternalHeap<T, Compare>::remove() {
+
+	this->pop();
+}
+
+/*
+* Get the peek item in the heap
+* @return the peek item in the heap
+*/
+template <class T, class Compare>
+const T& ExternalHeap<T, Compare>::peek() const {
+
+	if (!this->heads.isEmpty() && (this->hot.isEmpty() || this->comp(this->hot.peek(), this->heads.peek().item))) {
+
+		return this->heads.peek().item;
+	}
+
+	if (this->hot.isEmpty()) {
+
+		throw ExternalHeap::EMPTY;
+	}
+
+	return this->hot.peek();
+}
+
+/*
+* Get the number of items in the heap, in memory & on disk
+* @return the number of items
+*/
+template <class T, class Compare>
+long long ExternalHeap<T, Compare>::size() const {
+
+	return this->hot.getNodes() + this->spilled;
+}
+
+/*
+* Check if heap is empty
+* @return true if empty, else false
+*/
+template <class T, class Compare>
+bool ExternalHeap<T, Compare>::isEmpty() const {
+
+	return this->size() == 0;
+}
+
+/*
+* Get the number of runs on disk
+* @return the number of runs
+*/
+template <class T, class Compare>
+int ExternalHeap<T, Compare>::getRuns() const {
+
+	return static_cast<int>(this->runs.size());
+}
+
+/*
+* Clear the heap, deleting every run
+*/
+template <class T, class Compare>
+void ExternalHeap<T, Compare>::clear() {
+
+	for (Run& run : this->runs) {
+
+		ExternalHeap::destroy(run);
+	}
+
+	this->runs.clear();
+	this->heads.clear();
+	this->hot.clear();
+
+	this->spilled = 0;
+}
+
+  //**************// //**************// //**************//
+ //*  PRIVATE:  *// //*  PRIVATE:  *// //*  PRIVATE:  *//
+//**************// //**************// //**************//
+
+/*
+* Drains the hot heap into a new run, merging runs first if too many
+*/
+template <class T, class Compare>
+void ExternalHeap<T, Compare>::spill() {
+
+	if (static_cast<int>(this->runs.size()) >= this->maxRuns) {
+
+		this->merge();
+	}
+
+	// A sorted array is still a heap, so a failed write loses no item
+	this->hot.sort();
+
+	this->runs.reserve(this->runs.size() + 1);
+
+	Run run = this->create();
+
+	try {
+
+		for (const T* items = this->hot.begin(); items < this->hot.end(); items += this->blockItems) {
+
+			std::size_t count = std::min<std::size_t>(this->hot.end() - items, this->blockItems);
+
+			this->write(run, items, count);
+		}
+
+		this->finish(run);
+
+	} catch (...) {
+
+		ExternalHeap::destroy(run);
+		throw;
+	}
+
+	this->hot.clear();
+
+	this->spilled += run.items;
+	this->runs.push_back(std::move(run));
+
+	this->heads.add(Head{this->runs.back().block.front(), static_cast<int>(this->runs.size()) - 1});
+}
+
+/*
+* Merges the smaller half of the runs into one
+*/
+template <class T, class Compare>
+void ExternalHeap<T, Compare>::merge() {
+
+	std::vector<int> order(this->runs.size());
+	std::iota(order.begin(), order.end(), 0);
+
+	std::sort(order.begin(), order.end(), [this](int run1, int run2) {
+
+		return this->runs[run1].items < this->runs[run2].items;
+	});
+
+	int count = static_cast<int>(order.size()) / 2;
+
+	// Runs are read through copies sharing their files, rewound if the merge
+	// fails, so the runs stay as they were until the merged run is written
+	std::vector<Run> cursors;
+	std::vector<long> offsets;
+
+	BasicHeap<Head, HeadCompare> merging(HeadCompare{this->comp});
+
+	for (int i(0); i < count; ++i) {
+
+		const Run& run = this->runs[order[i]];
+		long offset = std::ftell(run.file);
+
+		if (offset < 0) {
+
+			throw std::system_error(errno, std::generic_category(), "ftell " + run.path);
+		}
+
+		offsets.push_back(offset);
+		cursors.push_back(run);
+
+		merging.add(Head{run.block[run.next], i});
+	}
+
+	this->runs.reserve(this->runs.size() + 1);
+
+	Run merged = this->create();
+
+	try {
+
+		std::vector<T> items;
+		items.reserve(this->blockItems);
+
+		while (!merging.isEmpty()) {
+
+			Head head = merging.pop();
+			Run& run = cursors[head.run];
+
+			items.push_back(head.item);
+
+			if (static_cast<int>(items.size()) == this->blockItems) {
+
+				this->write(merged, items.data(), items.size());
+				items.clear();
+			}
+
+			if (this->advance(run)) {
+
+				merging.add(Head{run.block[run.next], head.run});
+			}
+		}
+
+		this->write(merged, items.data(), items.size());
+		this->finish(merged);
+
+	} catch (...) {
+
+		ExternalHeap::destroy(merged);
+
+		for (int i(0); i < count; ++i) {
+
+			std::fseek(cursors[i].file, offsets[i], SEEK_SET);
+		}
+
+		throw;
+	}
+
+	// Emptied, the runs merged are deleted by prune
+	for (int i(0); i < count; ++i) {
+
+		this->runs[order[i]].items = 0;
+	}
+
+	this->runs.push_back(std::move(merged));
+
+	this->prune();
+}
+
+/*
+* Removes the first item of the run with the peek head
+* @return the item
+*/
+template <class T, class Compare>
+T ExternalHeap<T, Compare>::take() {
+
+	Head head = this->heads.pop();
+	Run& run = this->runs[head.run];
+
+	--this->spilled;
+
+	if (this->advance(run)) {
+
+		this->heads.add(Head{run.block[run.next], head.run});
+
+	} else {
+
+		this->prune();
+	}
+
+	return head.item;
+}
+
+/*
+* Advances past the first item of a run, reading its next block if needed
+* @param run The run
+* @return true if the run has more items, else false
+*/
+template <class T, class Compare>
+bool ExternalHeap<T, Compare>::advance(Run& run) {
+
+	--run.items;
+
+	if (++run.next < run.block.size()) {
+
+		return true;
+	}
+
+	return this->fill(run);
+}
+
+/*
+* Reads the next block of a run
+* @param run The run
+* @return true if any item was read, else false
+*/
+template <class T, class Compare>
+bool ExternalHeap<T, Compare>::fill(Run& run) {
+
+	run.block.resize(this->blockItems);
+
+	std::size_t count = std::fread(run.block.data(), sizeof(T), run.block.size(), run.file);
+
+	if (count < run.block.size() && std::ferror(run.file)) {
+
+		throw std::system_error(errno, std::generic_category(), "fread " + run.path);
+	}
+
+	run.block.resize(count);
+	run.next = 0;
+
+	return count > 0;
+}
+
+/*
+* Creates an empty run file
+* @return the run
+*/
+template <class T, class Compare>
+typename ExternalHeap<T, Compare>::Run ExternalHeap<T, Compare>::create() {
+
+	std::string prefix = this->directory + "/heap-" + std::to_string(reinterpret_cast<std::uintptr_t>(this)) + "-";
+
+	for (;;) {
+
+		std::string path = prefix + std::to_string(this->created++) + ".run";
+
+		// Created exclusively, so runs of other heaps are never reused
+		std::FILE* file = std::fopen(path.c_str(), "w+bx");
+
+		if (file != nullptr) {
+
+			return Run{file, path, std::vector<T>(), 0, 0};
+		}
+
+		if (errno != EEXIST) {
+
+			throw std::system_error(errno, std::generic_category(), "fopen " + path);
+		}
+	}
+}
+
+/*
+* Writes items to the end of a run
+* @param run The run
+* @param items The items to write
+* @param count The number of items
+*/
+template <class T, class Compare>
+void ExternalHeap<T, Compare>::write(Run& run, const T items[], std::size_t count) {
+
+	if (std::fwrite(items, sizeof(T), count, run.file) != count) {
+
+		throw std::system_error(errno, std::generic_category(), "fwrite " + run.path);
+	}
+
+	run.items += count;
+}
+
+/*
+* Rewinds a written run & reads its first block
+* @param run The run
+*/
+template <class T, class Compare>
+void ExternalHeap<T, Compare>::finish(Run& run) {
+
+	if (std::fflush(run.file) != 0) {
+
+		throw std::system_error(errno, std::generic_category(), "fflush " + run.path);
+	}
+
+	std::rewind(run.file);
+
+	this->fill(run);
+}
+
+/*
+* Removes runs with no items left, closing & deleting their files,
+* and rebuilds the heads of the runs remaining
+*/
+template <class T, class Compare>
+void ExternalHeap<T, Compare>::prune() {
+
+	std::size_t kept(0);
+
+	for (std::size_t i(0); i < this->runs.size(); ++i) {
+
+		if (this->runs[i].items == 0) {
+
+			ExternalHeap::destroy(this->runs[i]);
+
+		} else {
+
+			if (kept != i) {
+
+				this->runs[kept] = std::move(this->runs[i]);
+			}
+
+			++kept;
+		}
+	}
+
+	this->runs.erase(this->runs.begin() + kept, this->runs.end());
+
+	this->heads.clear();
+
+	for (int i(0); i < static_cast<int>(this->runs.size()); ++i) {
+
+		this->heads.add(Head{this->runs[i].block[this->runs[i].next], i});
+	}
+}
+
+/*
+* Static method
+* Closes & deletes the file of a run
+* @param run The run
+*/
+template <class T, class Compare>
+void ExternalHeap<T, Compare>::destroy(Run& run) {
+
+	std::fclose(run.file);
+	std::remove(run.path.c_str());
+}
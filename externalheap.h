@@ -0,0 +1,224 @@
+/*
+* externalheap.h
+*
+* Specifications for ExternalHeap class
+*
+* @author Juan Arias
+*
+*/
+
+#ifndef EXTERNALHEAP_H
+#define EXTERNALHEAP_H
+
+#include <cstddef>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "basicheap.h"
+
+/*
+* An ExternalHeap is a priority queue for more items than fit in memory.
+* Items are added to a hot BasicHeap holding half the memory budget; when
+* it fills, it is drained in priority order into a sorted run on disk. Runs
+* are read back one block at a time and merged lazily as items are removed,
+* through a BasicHeap of the runs' first items. Once the other half of the
+* budget is taken by run blocks, the smaller half of the runs is merged into
+* one, so each item is rewritten O(log n) times. Items are written as raw
+* bytes, so must be trivially copyable.
+*/
+template <class T, class Compare = std::less<T>>
+class ExternalHeap {
+
+	static_assert(std::is_trivially_copyable<T>::value, "ExternalHeap writes items as raw bytes");
+
+public:
+
+	/*
+	* Constructs empty heap
+	* @param memory The memory budget in bytes, for the hot heap & run blocks
+	* @param block The size in bytes of each read from or write to a run
+	* @param directory The directory runs are written to
+	* @param comp The comparator to order the heap by
+	*/
+	explicit ExternalHeap(std::size_t memory = MEMORY, std::size_t block = BLOCK,
+	                      const std::string& directory = ".", const Compare& comp = Compare());
+
+	ExternalHeap(const ExternalHeap& other) = delete;
+	ExternalHeap& operator=(const ExternalHeap& other) = delete;
+
+	/*
+	* Destroys heap, closing & deleting every run
+	*/
+	~ExternalHeap();
+
+	/*
+	* Add item to the heap, spilling the hot heap to a run if full. If the
+	* spill fails, the heap is left as it was & the error thrown
+	* @param item The item to add to the heap
+	*/
+	void add(const T& item);
+
+	/*
+	* Remove the peek item in the heap and return it
+	* @return the peek item
+	*/
+	T pop();
+
+	/*
+	* Remove the peek item in the heap
+	*/
+	void remove();
+
+	/*
+	* Get the peek item in the heap
+	* @return the peek item in the heap
+	*/
+	const T& peek() const;
+
+	/*
+	* Get the number of items in the heap, in memory & on disk
+	* @return the number of items
+	*/
+	long long size() const;
+
+	/*
+	* Check if heap is empty
+	* @return true if empty, else false
+	*/
+	bool isEmpty() const;
+
+	/*
+	* Get the number of runs on disk
+	* @return the number of runs
+	*/
+	int getRuns() const;
+
+	/*
+	* Clear the heap, deleting every run
+	*/
+	void clear();
+
+private:
+
+	// A sorted run on disk & the block of it read into memory
+	struct Run {
+
+		std::FILE* file;
+		std::string path;
+		std::vector<T> block;
+		std::size_t next;
+		long long items;
+	};
+
+	// First unread item of a run, ordered by the item
+	struct Head {
+
+		T item;
+		int run;
+
+		bool operator==(const Head& other) const { return this->run == other.run && this->item == other.item; }
+	};
+
+	// Comparator ordering heads by their items
+	struct HeadCompare {
+
+		Compare comp;
+
+		bool operator()(const Head& head1, const Head& head2) const { return this->comp(head1.item, head2.item); }
+	};
+
+	// Items added since the last spill
+	BasicHeap<T, Compare> hot;
+
+	// Runs on disk & the heap of their first items
+	std::vector<Run> runs;
+	BasicHeap<Head, HeadCompare> heads;
+
+	// Items in hot at most, items per block & runs kept before merging
+	int limit, blockItems, maxRuns;
+
+	// Directory runs are written to & runs created, for unique names
+	std::string directory;
+	long long created;
+
+	// Items in runs
+	long long spilled;
+
+	// Comparator ordering the heap, comp(a, b) is true if b has priority
+	Compare comp;
+
+	// Default constants for memory budget & block size in bytes
+	static const std::size_t MEMORY = std::size_t(1) << 26, BLOCK = std::size_t(1) << 20;
+
+	// Constant for empty heap, thrown by peek & pop
+	static const int EMPTY = 0;
+
+	/*
+	* Drains the hot heap into a new run, merging runs first if too many
+	*/
+	void spill();
+
+	/*
+	* Merges the smaller half of the runs into one
+	*/
+	void merge();
+
+	/*
+	* Removes the first item of the run with the peek head
+	* @return the item
+	*/
+	T take();
+
+	/*
+	* Advances past the first item of a run, reading its next block if needed
+	* @param run The run
+	* @return true if the run has more items, else false
+	*/
+	bool advance(Run& run);
+
+	/*
+	* Reads the next block of a run
+	* @param run The run
+	* @return true if any item was read, else false
+	*/
+	bool fill(Run& run);
+
+	/*
+	* Creates an empty run file
+	* @return the run
+	*/
+	Run create();
+
+	/*
+	* Writes items to the end of a run
+	* @param run The run
+	* @param items The items to write
+	* @param count The number of items
+	*/
+	void write(Run& run, const T items[], std::size_t count);
+
+	/*
+	* Rewinds a written run & reads its first block
+	* @param run The run
+	*/
+	void finish(Run& run);
+
+	/*
+	* Removes runs with no items left, closing & deleting their files,
+	* and rebuilds the heads of the runs remaining
+	*/
+	void prune();
+
+	/*
+	* Static method
+	* Closes & deletes the file of a run
+	* @param run The run
+	*/
+	static void destroy(Run& run);
+
+};
+
+#include "externalheap.cpp"
+#endif // EXTERNALHEAP_H
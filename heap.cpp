@@ -8,8 +8,18 @@
 */
 
 #include <iostream>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
 #include "heap.h"
 
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
 // Type definition for Nodes in a heap
 using Node = int;
 
@@ -20,8 +30,8 @@ using Node = int;
 /*
 * Destroys heap and deallocates all dynamic memory
 */
-template <class T>
-Heap<T>::~Heap() {
+template <class T, class Alloc>
+Heap<T, Alloc>::~Heap() {
 
 	this->clear();
 }
@@ -31,21 +41,75 @@ Heap<T>::~Heap() {
 * @param other The other heap to copy
 * @return this heap by reference
 */
-template<class T>
-Heap<T>& Heap<T>::operator=(const Heap<T>& other) {
+template <class T, class Alloc>
+Heap<T, Alloc>& Heap<T, Alloc>::operator=(const Heap<T, Alloc>& other) {
 
 	if (this != &other) {
 
-		if (this->MAX != other.MAX) {
+		this->destroyItems();
+
+		if (std::allocator_traits<Alloc>::propagate_on_container_copy_assignment::value
+		    && this->alloc != other.alloc) {
 
 			this->clear();
-			this->arr = new T[other.MAX];
-			this->MAX = other.MAX;
+			this->alloc = other.alloc;
+		}
+
+		if (this->MAX < other.itemCount) {
+
+			this->reallocate(other.MAX);
+		}
+
+		this->growth = other.growth;
+
+		this->copyArray(other.arr, other.itemCount);
+	}
+
+	return (*this);
+}
+
+/*
+* Move assignment operator overload
+* @param other The other heap to move from, left empty
+* @return this heap by reference
+*/
+template <class T, class Alloc>
+Heap<T, Alloc>& Heap<T, Alloc>::operator=(Heap<T, Alloc>&& other) {
+
+	if (this != &other) {
+
+		this->clear();
+
+		this->growth = other.growth;
+
+		// An array other does not own must not be freed by this heap's allocator
+		if (!other.ownsArray()) {
+
+			this->moveItems(other);
+
+			return (*this);
 		}
 
+		if (std::allocator_traits<Alloc>::propagate_on_container_move_assignment::value) {
+
+			this->alloc = std::move(other.alloc);
+
+		} else if (this->alloc != other.alloc) {
+
+			// The array must be freed by the allocator it came from
+			this->moveItems(other);
+
+			return (*this);
+		}
+
+		this->arr = other.arr;
 		this->itemCount = other.itemCount;
+		this->MAX = other.MAX;
+		this->pad = other.pad;
 
-		this->copyArray(other.arr);
+		other.arr = nullptr;
+		other.itemCount = Heap<T, Alloc>::EMPTY;
+		other.MAX = Heap<T, Alloc>::EMPTY;
 	}
 
 	return (*this);
@@ -56,8 +120,8 @@ Heap<T>& Heap<T>::operator=(const Heap<T>& other) {
 * @param other The other heap to compare
 * @return true if equal, else false
 */
-template <class T>
-bool Heap<T>::operator==(const Heap<T>& other) const {
+template <class T, class Alloc>
+bool Heap<T, Alloc>::operator==(const Heap<T, Alloc>& other) const {
 
 	bool equal(true);
 
@@ -69,7 +133,7 @@ bool Heap<T>::operator==(const Heap<T>& other) const {
 
 		} else {
 	
-			for (Node curr(Heap<T>::ROOT); (curr < this->itemCount && equal); ++curr) {
+			for (Node curr(Heap<T, Alloc>::ROOT); (curr < this->itemCount && equal); ++curr) {
 
 				equal = (this->arr[curr] == other.arr[curr]);
 			}
@@ -84,8 +148,8 @@ bool Heap<T>::operator==(const Heap<T>& other) const {
 * @param other The other heap to compare
 * @return true if not equal, else false
 */
-template <class T>
-bool Heap<T>::operator!=(const Heap<T>& other) const {
+template <class T, class Alloc>
+bool Heap<T, Alloc>::operator!=(const Heap<T, Alloc>& other) const {
 	
 	return !((*this) == other);
 }
@@ -94,20 +158,20 @@ bool Heap<T>::operator!=(const Heap<T>& other) const {
 * Check if heap is empty
 * @return true if empty, else false
 */
-template <class T>
-bool Heap<T>::isEmpty() const {
+template <class T, class Alloc>
+bool Heap<T, Alloc>::isEmpty() const {
 	
-	return (this->itemCount == Heap<T>::EMPTY);
+	return (this->itemCount == Heap<T, Alloc>::EMPTY);
 }
 
 /*
 * Get the height of the heap
 * @return the height of the heap
 */
-template <class T>
-int Heap<T>::getHeight() const {
+template <class T, class Alloc>
+int Heap<T, Alloc>::getHeight() const {
 
-	Node curr(Heap<T>::ROOT);
+	Node curr(Heap<T, Alloc>::ROOT);
 
 	int height(0);
 
@@ -115,7 +179,7 @@ int Heap<T>::getHeight() const {
 	
 		++height;
 
-		curr = Heap<T>::left(curr);
+		curr = Heap<T, Alloc>::left(curr, this->arity);
 	}
 
 	return height;
@@ -125,8 +189,8 @@ int Heap<T>::getHeight() const {
 * Get the number of nodes in the heap
 * @return the number of nodes in the heap
 */
-template <class T>
-int Heap<T>::getNodes() const {
+template <class T, class Alloc>
+int Heap<T, Alloc>::getNodes() const {
 	
 	return this->itemCount;
 }
@@ -135,29 +199,121 @@ int Heap<T>::getNodes() const {
 * Get the peek item in the heap
 * @return the peek item in the heap
 */
-template <class T>
-T& Heap<T>::peek() const {
+template <class T, class Alloc>
+T& Heap<T, Alloc>::peek() const {
 
-	if (this->arr != nullptr && this->itemCount > Heap<T>::EMPTY) {
+	if (this->arr != nullptr && this->itemCount > Heap<T, Alloc>::EMPTY) {
 		
-		return this->arr[Heap<T>::ROOT];
+		return this->arr[Heap<T, Alloc>::ROOT];
+	}
+
+	throw Heap<T, Alloc>::EMPTY;
+}
+
+/*
+* Get the number of items the heap can hold before it must grow
+* @return the capacity of the heap
+*/
+template <class T, class Alloc>
+int Heap<T, Alloc>::getCapacity() const {
+
+	return this->MAX;
+}
+
+/*
+* Get the factor the capacity is multiplied by when the heap grows
+* @return the growth factor of the heap
+*/
+template <class T, class Alloc>
+double Heap<T, Alloc>::getGrowthFactor() const {
+
+	return this->growth;
+}
+
+/*
+* Set the factor the capacity is multiplied by when the heap grows,
+* factors not greater than 1 are ignored
+* @param factor The new growth factor
+*/
+template <class T, class Alloc>
+void Heap<T, Alloc>::setGrowthFactor(double factor) {
+
+	if (factor > 1.0) {
+
+		this->growth = factor;
+	}
+}
+
+/*
+* Grow the capacity of the heap to at least the given capacity
+* @param capacity The minimum capacity of the heap
+*/
+template <class T, class Alloc>
+void Heap<T, Alloc>::reserve(int capacity) {
+
+	if (capacity > this->MAX) {
+
+		this->reallocate(capacity);
+	}
+}
+
+/*
+* Shrink the capacity of the heap to the number of nodes in the heap
+*/
+template <class T, class Alloc>
+void Heap<T, Alloc>::shrinkToFit() {
+
+	if (this->itemCount < this->MAX) {
+
+		this->reallocate(this->itemCount);
 	}
+}
+
+/*
+* Get the allocator of the array
+* @return a copy of the allocator
+*/
+template <class T, class Alloc>
+Alloc Heap<T, Alloc>::getAllocator() const {
+
+	return this->alloc;
+}
+
+/*
+* Get the first item of the array, in no particular order, to scan the
+* heap in place; invalidated by any change to the heap
+* @return a pointer to the first item
+*/
+template <class T, class Alloc>
+const T* Heap<T, Alloc>::begin() const {
+
+	return this->arr;
+}
+
+/*
+* Get the end of the array
+* @return a pointer past the last item
+*/
+template <class T, class Alloc>
+const T* Heap<T, Alloc>::end() const {
 
-	throw Heap<T>::EMPTY;
+	return this->arr + this->itemCount;
 }
 
 /*
 * Clear the heap
 */
-template <class T>
-void Heap<T>::clear() {
+template <class T, class Alloc>
+void Heap<T, Alloc>::clear() {
 
 	if (this->arr != nullptr) {
-		
-		delete[] this->arr;
+
+		this->destroyItems();
+
+		this->deallocate(this->arr, this->MAX, this->pad);
 
 		this->arr = nullptr;
-		this->itemCount = Heap<T>::EMPTY;
+		this->MAX = Heap<T, Alloc>::EMPTY;
 	}
 }
 
@@ -165,12 +321,24 @@ void Heap<T>::clear() {
 * Display heap sideways
 * @param
 */
-template<class T>
-void Heap<T>::displaySideways() {
+template <class T, class Alloc>
+void Heap<T, Alloc>::displaySideways() {
 
-	this->sideways(Heap<T>::ROOT, Heap<T>::EMPTY);
+	this->sideways(Heap<T, Alloc>::ROOT, Heap<T, Alloc>::EMPTY);
 }
 
+#ifdef HEAP_INSTRUMENT
+/*
+* Get the work done by this heap while instrumented
+* @return the statistics of this heap
+*/
+template <class T, class Alloc>
+const HeapStats& Heap<T, Alloc>::getStats() const {
+
+	return this->stats;
+}
+#endif
+
   //***************// //***************// //***************//
  //*  PROTECTED: *// //*  PROTECTED: *// //*  PROTECTED: *//
 //***************// //***************// //***************//
@@ -178,28 +346,170 @@ void Heap<T>::displaySideways() {
 /*
 * Constructs empty heap
 */
-template<class T>
-Heap<T>::Heap() :arr(nullptr), itemCount(Heap<T>::EMPTY), MAX(Heap<T>::EMPTY) {}
+template <class T, class Alloc>
+Heap<T, Alloc>::Heap() :Heap(Heap<T, Alloc>::BINARY) {}
+
+/*
+* Constructs empty heap with given number of children per node
+* @param arity The number of children per node
+* @param alloc The allocator of the array
+*/
+template <class T, class Alloc>
+Heap<T, Alloc>::Heap(int arity, const Alloc& alloc) :arr(nullptr), itemCount(Heap<T, Alloc>::EMPTY),
+                                                     MAX(Heap<T, Alloc>::EMPTY), growth(Heap<T, Alloc>::GROWTH),
+                                                     arity(arity), pad(arity - 1), alloc(alloc) {}
 
 /*
 * Constructs heap from given array
 * @param arr The array to construct heap from
 * @param size The size of arr
+* @param arity The number of children per node
+* @param alloc The allocator of the array
 */
-template<class T>
-Heap<T>::Heap(const T arr[], int size) :arr(new T[size * 2]), itemCount(size), MAX(size * 2) {
-	
-	this->copyArray(arr);
+template <class T, class Alloc>
+Heap<T, Alloc>::Heap(const T arr[], int size, int arity, const Alloc& alloc) :Heap(arity, alloc) {
+
+	this->arr = this->allocate(size * 2, this->pad);
+	this->MAX = size * 2;
+
+	this->copyArray(arr, size);
+}
+
+/*
+* Move constructor, moving each item if other does not own its array
+* @param other The other heap to move from, left empty
+*/
+template <class T, class Alloc>
+Heap<T, Alloc>::Heap(Heap<T, Alloc>&& other) :arr(nullptr), itemCount(Heap<T, Alloc>::EMPTY),
+                                              MAX(Heap<T, Alloc>::EMPTY), growth(other.growth),
+                                              arity(other.arity), pad(other.arity - 1),
+                                              alloc(std::move(other.alloc)) {
+
+	// An array other does not own must not be freed by this heap's allocator
+	if (!other.ownsArray()) {
+
+		this->moveItems(other);
+		return;
+	}
+
+	this->arr = other.arr;
+	this->itemCount = other.itemCount;
+	this->MAX = other.MAX;
+	this->pad = other.pad;
+
+	other.arr = nullptr;
+	other.itemCount = Heap<T, Alloc>::EMPTY;
+	other.MAX = Heap<T, Alloc>::EMPTY;
 }
 
 /*
 * Default initialization
 */
-template<class T>
-void Heap<T>::initialize() {
+template <class T, class Alloc>
+void Heap<T, Alloc>::initialize() {
 
-	this->arr = new T[Heap<T>::DEFAULT / 2];
-	this->MAX = Heap<T>::DEFAULT;
+	this->reallocate(Heap<T, Alloc>::DEFAULT);
+}
+
+/*
+* Grows the array geometrically, moving every item into the new array
+*/
+template <class T, class Alloc>
+void Heap<T, Alloc>::grow() {
+
+	if (this->MAX == Heap<T, Alloc>::EMPTY) {
+
+		this->initialize();
+
+	} else {
+
+		long long capacity = static_cast<long long>(this->MAX * this->growth);
+
+		if (capacity <= this->MAX) {
+
+			capacity = this->MAX + 1LL;
+		}
+
+		this->reallocate(capacity < INT_MAX ? static_cast<int>(capacity) : INT_MAX);
+
+		HeapStats::reallocate();
+	}
+}
+
+/*
+* Moves every item into a new array of the given capacity, overridden by
+* storage that resizes its array in place
+* @param capacity The capacity of the new array
+*/
+template <class T, class Alloc>
+void Heap<T, Alloc>::reallocate(int capacity) {
+
+	T* moved = this->allocate(capacity, this->arity - 1);
+
+	for (Node curr(Heap<T, Alloc>::ROOT); curr < this->itemCount; ++curr) {
+
+		new (&moved[curr]) T(std::move_if_noexcept(this->arr[curr]));
+	}
+
+	for (Node curr(Heap<T, Alloc>::ROOT); curr < this->itemCount; ++curr) {
+
+		this->arr[curr].~T();
+	}
+
+	this->deallocate(this->arr, this->MAX, this->pad);
+
+	this->arr = moved;
+	this->MAX = capacity;
+	this->pad = this->arity - 1;
+}
+
+/*
+* Whether the items in the array form a heap, overridden by storage that
+* may reopen items no longer in order
+* @return true if in order, else false
+*/
+template <class T, class Alloc>
+bool Heap<T, Alloc>::isOrdered() const {
+
+	return true;
+}
+
+/*
+* Whether the array was allocated by this heap's allocator, overridden by
+* storage that keeps it elsewhere, so heaps moved from it move each item
+* @return true if owned, else false
+*/
+template <class T, class Alloc>
+bool Heap<T, Alloc>::ownsArray() const {
+
+	return true;
+}
+
+/*
+* Constructs item at the end of the array, growing it if full
+* @param args The arguments to construct the item from
+*/
+template <class T, class Alloc>
+template<class... Args>
+void Heap<T, Alloc>::append(Args&&... args) {
+
+	if (this->itemCount == this->MAX) {
+
+		// args may refer to an item in the array, so build it before growing
+		T item(std::forward<Args>(args)...);
+
+		this->grow();
+
+		new (&this->arr[this->itemCount]) T(std::move(item));
+
+	} else {
+
+		new (&this->arr[this->itemCount]) T(std::forward<Args>(args)...);
+	}
+
+	++this->itemCount;
+
+	HeapStats::add(this->itemCount);
 }
 
 /*
@@ -207,40 +517,66 @@ void Heap<T>::initialize() {
 * @param node1 The index of the first node
 * @param node2 The index of the second node
 */
-template<class T>
-void Heap<T>::swap(Node node1, Node node2) {
+template <class T, class Alloc>
+void Heap<T, Alloc>::swap(Node node1, Node node2) {
 
-	Heap<T>::swap(this->arr, node1, node2);
+	Heap<T, Alloc>::swap(this->arr, node1, node2);
 }
 
 /*
 * Static method
 * Checks if the given node is a leaf
 * @param curr The current node
+* @param arity The number of children per node
 * @return true if leaf, else false
 */
-template<class T>
-bool Heap<T>::isLeaf(Node curr, int itemCount) {
+template <class T, class Alloc>
+bool Heap<T, Alloc>::isLeaf(Node curr, int itemCount, int arity) {
 
-	return (Heap<T>::left(curr) >= itemCount);
+	return (Heap<T, Alloc>::left(curr, arity) >= itemCount);
 }
 
 /*
 * Static method
 * Gets the larger of the given node's children
 * @param curr The current node
+* @param comp The comparator deciding which child is larger
+* @param arity The number of children per node
 * @return the larger child
 */
-template<class T>
-Node Heap<T>::largerChild(T arr[], int itemCount, Node curr) {
+template <class T, class Alloc>
+template<class Compare>
+Node Heap<T, Alloc>::largerChild(T arr[], int itemCount, Node curr, const Compare& comp, int arity) {
 
-	Node larger = Heap<T>::left(curr);
+	Node larger = Heap<T, Alloc>::left(curr, arity);
 
-	if (Heap<T>::hasRight(curr, itemCount)) {
+	if (arity == Heap<T, Alloc>::BINARY) {
 
-		Node right = Heap<T>::right(curr);
+		if (Heap<T, Alloc>::hasRight(curr, itemCount)) {
 
-		larger = (arr[right] > arr[larger]) ? right : larger;
+			Node right = Heap<T, Alloc>::right(curr);
+
+			larger = comp(arr[larger], arr[right]) ? right : larger;
+		}
+
+	} else {
+
+		Node first = larger;
+
+		if (first + arity <= itemCount) {
+
+			for (int child(1); child < arity; ++child) {
+
+				larger = comp(arr[larger], arr[first + child]) ? first + child : larger;
+			}
+
+		} else {
+
+			for (Node child(first + 1); child < itemCount; ++child) {
+
+				larger = comp(arr[larger], arr[child]) ? child : larger;
+			}
+		}
 	}
 
 	return larger;
@@ -250,12 +586,13 @@ Node Heap<T>::largerChild(T arr[], int itemCount, Node curr) {
 * Static method
 * Gets the parent of the given node
 * @param curr The current node
+* @param arity The number of children per node
 * @return the parent of curr
 */
-template<class T>
-Node Heap<T>::parent(Node curr) {
+template <class T, class Alloc>
+Node Heap<T, Alloc>::parent(Node curr, int arity) {
 
-	return (curr - 1) / 2;
+	return (curr - 1) / arity;
 }
 
 /*
@@ -264,12 +601,12 @@ Node Heap<T>::parent(Node curr) {
 * @param node1 The index of the first node
 * @param node2 The index of the second node
 */
-template<class T>
-void Heap<T>::swap(T arr[], Node node1, Node node2) {
+template <class T, class Alloc>
+void Heap<T, Alloc>::swap(T arr[], Node node1, Node node2) {
 
-	T temp = arr[node1];
-	arr[node1] = arr[node2];
-	arr[node2] = temp;
+	T temp = std::move(arr[node1]);
+	arr[node1] = std::move(arr[node2]);
+	arr[node2] = std::move(temp);
 }
 
   //**************// //**************// //**************//
@@ -279,26 +616,166 @@ void Heap<T>::swap(T arr[], Node node1, Node node2) {
 /*
 * Copies elements of given array and forms heap
 * @param arr The given array to copy
+* @param size The size of arr
 */
-template<class T>
-void Heap<T>::copyArray(const T arr[]) {
+template <class T, class Alloc>
+void Heap<T, Alloc>::copyArray(const T arr[], int size) {
 
-	for (Node curr(Heap<T>::ROOT); curr < this->itemCount; ++curr) {
+	while (this->itemCount < size) {
 
-		this->arr[curr] = arr[curr];
+		new (&this->arr[this->itemCount]) T(arr[this->itemCount]);
+		++this->itemCount;
+	}
+}
+
+/*
+* Destroys every item in the array without deallocating it
+*/
+template <class T, class Alloc>
+void Heap<T, Alloc>::destroyItems() {
+
+	while (this->itemCount > Heap<T, Alloc>::EMPTY) {
+
+		this->arr[--this->itemCount].~T();
+	}
+}
+
+/*
+* Allocates uninitialized cache line aligned array of given capacity,
+* huge page aligned & advised when large
+* @param capacity The capacity of the array
+* @param pad The number of unused slots before the array
+* @return the array, nullptr if capacity is empty
+*/
+template <class T, class Alloc>
+T* Heap<T, Alloc>::allocate(int capacity, int pad) {
+
+	if (capacity <= Heap<T, Alloc>::EMPTY) {
+
+		return nullptr;
+	}
+
+	std::size_t bytes = sizeof(T) * (static_cast<std::size_t>(capacity) + pad);
+	std::size_t alignment = Heap<T, Alloc>::alignFor(bytes);
+
+	unsigned char* base;
+
+	if constexpr (std::is_same<Alloc, std::allocator<T>>::value) {
+
+		base = static_cast<unsigned char*>(::operator new(bytes, static_cast<std::align_val_t>(alignment)));
+
+	} else {
+
+		// Rebinds to bytes and aligns by hand, keeping the offset to the block before the array
+		typename std::allocator_traits<Alloc>::template rebind_alloc<unsigned char> bytesAlloc(this->alloc);
+
+		unsigned char* block = std::allocator_traits<decltype(bytesAlloc)>::allocate(
+			bytesAlloc, bytes + alignment + sizeof(std::size_t));
+
+		std::uintptr_t start = reinterpret_cast<std::uintptr_t>(block) + sizeof(std::size_t);
+
+		base = block + ((start + alignment - 1) / alignment * alignment - reinterpret_cast<std::uintptr_t>(block));
+
+		std::size_t offset = base - block;
+		std::memcpy(base - sizeof(std::size_t), &offset, sizeof(std::size_t));
+	}
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+	if (bytes >= Heap<T, Alloc>::HUGE_PAGE) {
+
+		madvise(base, bytes / Heap<T, Alloc>::HUGE_PAGE * Heap<T, Alloc>::HUGE_PAGE, MADV_HUGEPAGE);
+	}
+#endif
+
+	return reinterpret_cast<T*>(base) + pad;
+}
+
+/*
+* Deallocates array returned by allocate
+* @param arr The array to deallocate
+* @param capacity The capacity the array was allocated with
+* @param pad The number of unused slots before the array
+*/
+template <class T, class Alloc>
+void Heap<T, Alloc>::deallocate(T arr[], int capacity, int pad) {
+
+	if (arr != nullptr) {
+
+		std::size_t bytes = sizeof(T) * (static_cast<std::size_t>(capacity) + pad);
+		std::size_t alignment = Heap<T, Alloc>::alignFor(bytes);
+
+		unsigned char* base = reinterpret_cast<unsigned char*>(arr - pad);
+
+		if constexpr (std::is_same<Alloc, std::allocator<T>>::value) {
+
+			::operator delete(base, static_cast<std::align_val_t>(alignment));
+
+		} else {
+
+			typename std::allocator_traits<Alloc>::template rebind_alloc<unsigned char> bytesAlloc(this->alloc);
+
+			std::size_t offset;
+			std::memcpy(&offset, base - sizeof(std::size_t), sizeof(std::size_t));
+
+			std::allocator_traits<decltype(bytesAlloc)>::deallocate(
+				bytesAlloc, base - offset, bytes + alignment + sizeof(std::size_t));
+		}
 	}
 }
 
+/*
+* Static method
+* Gets the alignment of an array of the given size
+* @param bytes The size of the array in bytes
+* @return the alignment in bytes
+*/
+template <class T, class Alloc>
+std::size_t Heap<T, Alloc>::alignFor(std::size_t bytes) {
+
+	std::size_t alignment = Heap<T, Alloc>::CACHE_LINE;
+
+	if (alignof(T) > alignment) {
+
+		alignment = alignof(T);
+	}
+
+	if (bytes >= Heap<T, Alloc>::HUGE_PAGE) {
+
+		alignment = Heap<T, Alloc>::HUGE_PAGE;
+	}
+
+	return alignment;
+}
+
+/*
+* Moves every item of the given heap into this one, which is empty
+* @param other The other heap to move from
+*/
+template <class T, class Alloc>
+void Heap<T, Alloc>::moveItems(Heap<T, Alloc>& other) {
+
+	this->reserve(other.itemCount);
+
+	while (this->itemCount < other.itemCount) {
+
+		new (&this->arr[this->itemCount]) T(std::move(other.arr[this->itemCount]));
+		++this->itemCount;
+	}
+
+	other.clear();
+}
+
 /*
 * Static method
 * Gets the left child of the given node
 * @param curr The current node
+* @param arity The number of children per node
 * @return the left child of curr
 */
-template<class T>
-Node Heap<T>::left(Node curr) {
+template <class T, class Alloc>
+Node Heap<T, Alloc>::left(Node curr, int arity) {
 
-	return (2 * curr + 1);
+	return (arity * curr + 1);
 }
 
 /*
@@ -307,10 +784,10 @@ Node Heap<T>::left(Node curr) {
 * @param curr The current node
 * @return true if has right child, else false
 */
-template<class T>
-bool Heap<T>::hasRight(Node curr, int itemCount) {
+template <class T, class Alloc>
+bool Heap<T, Alloc>::hasRight(Node curr, int itemCount) {
 
-	return (Heap<T>::right(curr) < itemCount);
+	return (Heap<T, Alloc>::right(curr) < itemCount);
 }
 
 
@@ -320,8 +797,8 @@ bool Heap<T>::hasRight(Node curr, int itemCount) {
 * @param curr The current node
 * @return the right child of curr
 */
-template<class T>
-Node Heap<T>::right(Node curr) {
+template <class T, class Alloc>
+Node Heap<T, Alloc>::right(Node curr) {
 
 	return (2 * curr + 2);
 }
@@ -331,22 +808,30 @@ Node Heap<T>::right(Node curr) {
 * @param curr The current node
 * @param level the current level of the heap
 */
-template<class T>
-void Heap<T>::sideways(Node curr, int level) {
+template <class T, class Alloc>
+void Heap<T, Alloc>::sideways(Node curr, int level) {
 
 	if (curr < this->itemCount) {
 
 		++level;
 
-		this->sideways(Heap<T>::right(curr), level);
+		Node left = Heap<T, Alloc>::left(curr, this->arity);
 
-		for (int i(level); i >= Heap<T>::ROOT; --i) {
+		for (Node child(left + this->arity - 1); child >= left + this->arity / 2; --child) {
+
+			this->sideways(child, level);
+		}
+
+		for (int i(level); i >= Heap<T, Alloc>::ROOT; --i) {
 
 			std::cout << "    ";
 		}
 
 		std::cout << this->arr[curr] << std::endl;
 
-		this->sideways(Heap<T>::left(curr), level);
+		for (Node child(left + this->arity / 2 - 1); child >= left; --child) {
+
+			this->sideways(child, level);
+		}
 	}
 }
@@ -10,13 +10,18 @@
 #ifndef HEAP_H
 #define HEAP_H
 
+#include <cstddef>
+#include <memory>
+#include "heapstats.h"
+
 /*
-* A Heap is a binary-tree that is always complete (leaves filled in left to right),
+* A Heap is a d-ary tree (binary by default) that is always complete (leaves filled in left to right),
 * and either has the maximum value in the root and every node is greater than
 * or equal to it's children (max-heap) or the minmum value in the root and every
 * node is less than or equal to it's children (minheap).
+* Items live in uninitialized storage from Alloc, constructed in place.
 */
-template <class T>
+template <class T, class Alloc = std::allocator<T>>
 class Heap {
 
 // Type definition for Nodes in a heap
@@ -24,6 +29,9 @@ using Node = int;
 
 public:
 
+	// Type definition for the allocator of the array
+	using allocator_type = Alloc;
+
 	/*
 	* Destroys heap and deallocates all dynamic memory
 	*/
@@ -34,7 +42,14 @@ public:
 	* @param other The other heap to copy
 	* @return this heap by reference
 	*/
-	virtual Heap<T>& operator=(const Heap<T>& other);
+	virtual Heap& operator=(const Heap& other);
+
+	/*
+	* Move assignment operator overload
+	* @param other The other heap to move from, left empty
+	* @return this heap by reference
+	*/
+	virtual Heap& operator=(Heap&& other);
 
 	/*
 	* Add item to the heap
@@ -42,6 +57,12 @@ public:
 	*/
 	virtual void add(const T& item) = 0;
 
+	/*
+	* Add item to the heap by moving it
+	* @param item The item to move into the heap
+	*/
+	virtual void add(T&& item) = 0;
+
 	/*
 	* Remove the peek item in the heap
 	*/
@@ -57,14 +78,14 @@ public:
 	* @param other The other heap to compare
 	* @return true if equal, else false
 	*/
-	bool operator==(const Heap<T>& other) const;
+	bool operator==(const Heap& other) const;
 
 	/*
 	* Inequality operator overload
 	* @param other The other heap to compare
 	* @return true if not equal, else false
 	*/
-	bool operator!=(const Heap<T>& other) const;
+	bool operator!=(const Heap& other) const;
 
 	/*
 	* Check if heap is empty
@@ -90,16 +111,73 @@ public:
 	*/
 	T& peek() const;
 
+	/*
+	* Get the number of items the heap can hold before it must grow
+	* @return the capacity of the heap
+	*/
+	int getCapacity() const;
+
+	/*
+	* Get the factor the capacity is multiplied by when the heap grows
+	* @return the growth factor of the heap
+	*/
+	double getGrowthFactor() const;
+
+	/*
+	* Set the factor the capacity is multiplied by when the heap grows,
+	* factors not greater than 1 are ignored
+	* @param factor The new growth factor
+	*/
+	void setGrowthFactor(double factor);
+
+	/*
+	* Grow the capacity of the heap to at least the given capacity
+	* @param capacity The minimum capacity of the heap
+	*/
+	void reserve(int capacity);
+
+	/*
+	* Shrink the capacity of the heap to the number of nodes in the heap
+	*/
+	void shrinkToFit();
+
+	/*
+	* Get the allocator of the array
+	* @return a copy of the allocator
+	*/
+	Alloc getAllocator() const;
+
+	/*
+	* Get the first item of the array, in no particular order, to scan the
+	* heap in place; invalidated by any change to the heap
+	* @return a pointer to the first item
+	*/
+	const T* begin() const;
+
+	/*
+	* Get the end of the array
+	* @return a pointer past the last item
+	*/
+	const T* end() const;
+
 	/*
 	* Clear the heap
 	*/
-	void clear();
+	virtual void clear();
 
 	/*
 	* Display heap sideways
 	*/
 	void displaySideways();
 
+#ifdef HEAP_INSTRUMENT
+	/*
+	* Get the work done by this heap while instrumented
+	* @return the statistics of this heap
+	*/
+	const HeapStats& getStats() const;
+#endif
+
 protected:
 
 	// Pointer for dynamic array
@@ -108,9 +186,33 @@ protected:
 	// Item count in array and maximum possible size of array
 	int itemCount, MAX;
 
+	// Factor MAX is multiplied by when the array is full
+	double growth;
+
+	// Children per node & unused slots allocated before the root, which
+	// offset the array so each node's children share one cache line
+	int arity, pad;
+
+	// Allocator of the array
+	Alloc alloc;
+
+#ifdef HEAP_INSTRUMENT
+	// Work done by this heap, recorded while a HeapStats::Scope is open on it
+	HeapStats stats;
+#endif
+
 	// Default constant for MAX & empty constant
 	static const int DEFAULT = 100, EMPTY = 0;
 
+	// Constant for binary arity & bytes in a cache line
+	static const int BINARY = 2, CACHE_LINE = 64;
+
+	// Constant for bytes in a huge page, arrays this large are aligned to one
+	static const std::size_t HUGE_PAGE = std::size_t(1) << 21;
+
+	// Default constant for growth
+	static constexpr double GROWTH = 2.0;
+
 	// Constant for indexing root
 	static const Node ROOT = 0;
 
@@ -119,18 +221,66 @@ protected:
 	*/
 	Heap();
 
+	/*
+	* Constructs empty heap with given number of children per node
+	* @param arity The number of children per node
+	* @param alloc The allocator of the array
+	*/
+	explicit Heap(int arity, const Alloc& alloc = Alloc());
+
 	/*
 	* Constructs heap from given array
 	* @param arr The array to construct heap from
 	* @param size The size of arr
+	* @param arity The number of children per node
+	* @param alloc The allocator of the array
 	*/
-	Heap(const T arr[], int size);
+	Heap(const T arr[], int size, int arity = BINARY, const Alloc& alloc = Alloc());
+
+	/*
+	* Move constructor, moving each item if other does not own its array
+	* @param other The other heap to move from, left empty
+	*/
+	Heap(Heap&& other);
 
 	/*
 	* Default initialization
 	*/
 	void initialize();
 
+	/*
+	* Grows the array geometrically, moving every item into the new array
+	*/
+	void grow();
+
+	/*
+	* Moves every item into a new array of the given capacity, overridden by
+	* storage that resizes its array in place
+	* @param capacity The capacity of the new array
+	*/
+	virtual void reallocate(int capacity);
+
+	/*
+	* Whether the items in the array form a heap, overridden by storage that
+	* may reopen items no longer in order
+	* @return true if in order, else false
+	*/
+	virtual bool isOrdered() const;
+
+	/*
+	* Whether the array was allocated by this heap's allocator, overridden by
+	* storage that keeps it elsewhere, so heaps moved from it move each item
+	* @return true if owned, else false
+	*/
+	virtual bool ownsArray() const;
+
+	/*
+	* Constructs item at the end of the array, growing it if full
+	* @param args The arguments to construct the item from
+	*/
+	template <class... Args>
+	void append(Args&&... args);
+
 	/*
 	* Swaps the items in the given indexes
 	* @param node1 The index of the first node
@@ -142,25 +292,39 @@ protected:
 	* Static method
 	* Checks if the given node is a leaf
 	* @param curr The current node
+	* @param arity The number of children per node
 	* @return true if leaf, else false
 	*/
-	static bool isLeaf(Node curr, int itemCount);
+	static bool isLeaf(Node curr, int itemCount, int arity = BINARY);
 
 	/*
 	* Static method
 	* Gets the larger of the given node's children
 	* @param curr The current node
+	* @param comp The comparator deciding which child is larger
+	* @param arity The number of children per node
 	* @return the larger child
 	*/
-	static Node largerChild(T arr[], int itemCount, Node curr);
+	template <class Compare>
+	static Node largerChild(T arr[], int itemCount, Node curr, const Compare& comp, int arity = BINARY);
 
 	/*
 	* Static method
 	* Gets the parent of the given node
 	* @param curr The current node
+	* @param arity The number of children per node
 	* @return the parent of curr
 	*/
-	static Node parent(Node curr);
+	static Node parent(Node curr, int arity = BINARY);
+
+	/*
+	* Static method
+	* Gets the left child of the given node
+	* @param curr The current node
+	* @param arity The number of children per node
+	* @return the left child of curr
+	*/
+	static Node left(Node curr, int arity = BINARY);
 
 	/*
 	* Static method
@@ -175,24 +339,53 @@ private:
 	/*
 	* Copies elements of given array and forms heap
 	* @param arr The given array to copy
+	* @param size The size of arr
+	*/
+	void copyArray(const T arr[], int size);
+
+	/*
+	* Destroys every item in the array without deallocating it
+	*/
+	void destroyItems();
+
+	/*
+	* Allocates uninitialized cache line aligned array of given capacity,
+	* huge page aligned & advised when large
+	* @param capacity The capacity of the array
+	* @param pad The number of unused slots before the array
+	* @return the array, nullptr if capacity is empty
+	*/
+	T* allocate(int capacity, int pad);
+
+	/*
+	* Deallocates array returned by allocate
+	* @param arr The array to deallocate
+	* @param capacity The capacity the array was allocated with
+	* @param pad The number of unused slots before the array
 	*/
-	void copyArray(const T arr[]);
+	void deallocate(T arr[], int capacity, int pad);
 
 	/*
 	* Static method
-	* Checks if the given node has right child
-	* @param curr The current node
-	* @return true if has right child, else false
+	* Gets the alignment of an array of the given size
+	* @param bytes The size of the array in bytes
+	* @return the alignment in bytes
 	*/
-	static bool hasRight(Node curr, int itemCount);
+	static std::size_t alignFor(std::size_t bytes);
+
+	/*
+	* Moves every item of the given heap into this one, which is empty
+	* @param other The other heap to move from
+	*/
+	void moveItems(Heap& other);
 
 	/*
 	* Static method
-	* Gets the left child of the given node
+	* Checks if the given node has right child
 	* @param curr The current node
-	* @return the left child of curr
+	* @return true if has right child, else false
 	*/
-	static Node left(Node curr);
+	static bool hasRight(Node curr, int itemCount);
 
 	/*
 	* Static method
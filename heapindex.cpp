@@ -0,0 +1,93 @@
+#include "heapindex.h"
+/*
+* heapindex.cpp
+*
+* Implementations for NoIndex & HashIndex classes
+*
+* @author Juan Arias
+*
+*/
+
+  //**************// //**************// //**************//
+ //*  NOINDEX:  *// //*  NOINDEX:  *// //*  NOINDEX:  *//
+//**************// //**************// //**************//
+
+/*
+* Record an item added to the heap
+* @param item The item added
+*/
+template <class T>
+void NoIndex<T>::insert(const T&) {}
+
+/*
+* Record an item removed from the heap
+* @param item The item removed
+*/
+template <class T>
+void NoIndex<T>::erase(const T&) {}
+
+/*
+* Check if an item is in the heap
+* @param item The item to search for
+* @return false, NoIndex knows no items
+*/
+template <class T>
+bool NoIndex<T>::contains(const T&) const {
+
+	return false;
+}
+
+/*
+* Forget every item
+*/
+template <class T>
+void NoIndex<T>::clear() {}
+
+  //**************// //**************// //**************//
+ //*  HASHINDEX:*// //*  HASHINDEX:*// //*  HASHINDEX:*//
+//**************// //**************// //**************//
+
+/*
+* Record an item added to the heap
+* @param item The item added
+*/
+template <class T, class Hash, class Equal>
+void HashIndex<T, Hash, Equal>::insert(const T& item) {
+
+	++this->counts[item];
+}
+
+/*
+* Record an item removed from the heap
+* @param item The item removed
+*/
+template <class T, class Hash, class Equal>
+void HashIndex<T, Hash, Equal>::erase(const T& item) {
+
+	auto found = this->counts.find(item);
+
+	if (found != this->counts.end() && --found->second == 0) {
+
+		this->counts.erase(found);
+	}
+}
+
+/*
+* Check if an item is in the heap
+* @param item The item to search for
+* @return true if found, else false
+*/
+template <class T, class Hash, class Equal>
+bool HashIndex<T, Hash, Equal>::contains(const T& item) const {
+
+	return (this->counts.find(item) != this->counts.end());
+}
+
+/*
+* Forget every item
+*/
+template <class T, class Hash, class Equal>
+void HashIndex<T, Hash, Equal>::clear() {
+
+	this->counts.clear();
+}
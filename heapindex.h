@@ -0,0 +1,98 @@
+/*
+* heapindex.h
+*
+* Specifications for NoIndex & HashIndex classes
+*
+* @author Juan Arias
+*
+*/
+
+#ifndef HEAPINDEX_H
+#define HEAPINDEX_H
+
+#include <functional>
+#include <unordered_map>
+
+/*
+* A NoIndex is the default Index of a BasicHeap, it keeps nothing so contains
+* searches the heap and add & remove pay nothing for it.
+*/
+template <class T>
+class NoIndex {
+
+public:
+
+	// Constant telling BasicHeap whether contains can use the index
+	static const bool ENABLED = false;
+
+	/*
+	* Record an item added to the heap
+	* @param item The item added
+	*/
+	void insert(const T& item);
+
+	/*
+	* Record an item removed from the heap
+	* @param item The item removed
+	*/
+	void erase(const T& item);
+
+	/*
+	* Check if an item is in the heap
+	* @param item The item to search for
+	* @return false, NoIndex knows no items
+	*/
+	bool contains(const T& item) const;
+
+	/*
+	* Forget every item
+	*/
+	void clear();
+
+};
+
+/*
+* A HashIndex is an Index for a BasicHeap counting how many copies of each
+* value are in the heap, so contains is O(1) expected.
+*/
+template <class T, class Hash = std::hash<T>, class Equal = std::equal_to<T>>
+class HashIndex {
+
+public:
+
+	// Constant telling BasicHeap whether contains can use the index
+	static const bool ENABLED = true;
+
+	/*
+	* Record an item added to the heap
+	* @param item The item added
+	*/
+	void insert(const T& item);
+
+	/*
+	* Record an item removed from the heap
+	* @param item The item removed
+	*/
+	void erase(const T& item);
+
+	/*
+	* Check if an item is in the heap
+	* @param item The item to search for
+	* @return true if found, else false
+	*/
+	bool contains(const T& item) const;
+
+	/*
+	* Forget every item
+	*/
+	void clear();
+
+private:
+
+	// Number of copies of every value in the heap
+	std::unordered_map<T, int, Hash, Equal> counts;
+
+};
+
+#include "heapindex.cpp"
+#endif // HEAPINDEX_H
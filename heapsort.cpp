@@ -0,0 +1,191 @@
+#include "heapsort.h"
+/*
+* heapsort.cpp
+*
+* Implementations for heap sort functions over random access iterators
+*
+* @author Juan Arias
+*
+*/
+
+#include <utility>
+
+/*
+* Heap sorts the given range in ascending order of comp. Forms a heap
+* bottom-up, then moves the peek item behind the heap with bottom-up
+* sift-down, finishing ranges of HeapSort::INSERTION_CUTOFF or less by
+* insertion sort.
+* @param first The iterator to the first item to sort
+* @param last The iterator past the last item to sort
+* @param comp The comparator to sort by
+*/
+template <class Iterator, class Compare>
+void heapSort(Iterator first, Iterator last, Compare comp) {
+
+	int size = static_cast<int>(last - first);
+
+	if (size > HeapSort::INSERTION_CUTOFF) {
+
+		for (int curr((size - 2) / 2); curr >= 0; --curr) {
+
+			HeapSort::siftBounce(first, size, curr, std::move(first[curr]), comp);
+		}
+
+		while (size > HeapSort::INSERTION_CUTOFF) {
+
+			typename std::iterator_traits<Iterator>::value_type item = std::move(first[--size]);
+
+			first[size] = std::move(first[0]);
+
+			HeapSort::siftBounce(first, size, 0, std::move(item), comp);
+		}
+	}
+
+	HeapSort::insertionSort(first, first + size, comp);
+}
+
+/*
+* Rearranges the given range so [first, middle) holds the middle - first
+* items that come first in ascending order of comp, sorted, like
+* std::partial_sort. Sort by std::greater to get the top k items.
+* Keeps a heap of the k candidates, rejecting items with one comparison,
+* and keeps them sorted by insertion instead when k is HeapSort::INSERTION_CUTOFF
+* or less.
+* @param first The iterator to the first item
+* @param middle The iterator past the last item to sort
+* @param last The iterator past the last item
+* @param comp The comparator to sort by
+*/
+template <class Iterator, class Compare>
+void partialSortTopK(Iterator first, Iterator middle, Iterator last, Compare comp) {
+
+	int size = static_cast<int>(middle - first);
+
+	if (size == 0) {
+
+		return;
+	}
+
+	if (size <= HeapSort::INSERTION_CUTOFF) {
+
+		HeapSort::insertionSort(first, middle, comp);
+
+		for (Iterator curr(middle); curr != last; ++curr) {
+
+			if (comp(*curr, middle[-1])) {
+
+				typename std::iterator_traits<Iterator>::value_type item = std::move(*curr);
+
+				Iterator hole = middle - 1;
+
+				*curr = std::move(*hole);
+
+				for (; hole != first && comp(item, hole[-1]); --hole) {
+
+					*hole = std::move(hole[-1]);
+				}
+
+				*hole = std::move(item);
+			}
+		}
+
+		return;
+	}
+
+	for (int curr((size - 2) / 2); curr >= 0; --curr) {
+
+		HeapSort::siftBounce(first, size, curr, std::move(first[curr]), comp);
+	}
+
+	for (Iterator curr(middle); curr != last; ++curr) {
+
+		if (comp(*curr, *first)) {
+
+			typename std::iterator_traits<Iterator>::value_type item = std::move(*curr);
+
+			*curr = std::move(*first);
+
+			HeapSort::siftBounce(first, size, 0, std::move(item), comp);
+		}
+	}
+
+	heapSort(first, middle, comp);
+}
+
+/*
+* Static method
+* Insertion sorts the given range in ascending order of comp
+* @param first The iterator to the first item to sort
+* @param last The iterator past the last item to sort
+* @param comp The comparator to sort by
+*/
+template <class Iterator, class Compare>
+void HeapSort::insertionSort(Iterator first, Iterator last, Compare& comp) {
+
+	if (first == last) {
+
+		return;
+	}
+
+	for (Iterator curr(first + 1); curr != last; ++curr) {
+
+		typename std::iterator_traits<Iterator>::value_type item = std::move(*curr);
+
+		Iterator hole = curr;
+
+		for (; hole != first && comp(item, hole[-1]); --hole) {
+
+			*hole = std::move(hole[-1]);
+		}
+
+		*hole = std::move(item);
+	}
+}
+
+/*
+* Static method
+* Moves the hole at the given node down to a leaf along the larger children,
+* then sifts item up from the leaf to its position and moves it there
+* @param first The iterator to the root of the heap
+* @param size The size of the heap
+* @param hole The node of the hole
+* @param item The item to place
+* @param comp The comparator ordering the heap
+*/
+template <class Iterator, class Compare>
+void HeapSort::siftBounce(Iterator first, int size, int hole,
+                          typename std::iterator_traits<Iterator>::value_type item, Compare& comp) {
+
+	int start = hole;
+	int child = 2 * hole + 2;
+
+	while (child < size) {
+
+		child -= comp(first[child], first[child - 1]);
+
+		first[hole] = std::move(first[child]);
+		hole = child;
+		child = 2 * hole + 2;
+	}
+
+	if (child == size) {
+
+		first[hole] = std::move(first[child - 1]);
+		hole = child - 1;
+	}
+
+	while (hole > start) {
+
+		int parent = (hole - 1) / 2;
+
+		if (!comp(first[parent], item)) {
+
+			break;
+		}
+
+		first[hole] = std::move(first[parent]);
+		hole = parent;
+	}
+
+	first[hole] = std::move(item);
+}
@@ -0,0 +1,85 @@
+/*
+* heapsort.h
+*
+* Specifications for heap sort functions over random access iterators
+*
+* @author Juan Arias
+*
+*/
+
+#ifndef HEAPSORT_H
+#define HEAPSORT_H
+
+#include <functional>
+#include <iterator>
+
+/*
+* Heap sorts the given range in ascending order of comp. Forms a heap
+* bottom-up, then moves the peek item behind the heap with bottom-up
+* sift-down, finishing ranges of HeapSort::INSERTION_CUTOFF or less by
+* insertion sort.
+* @param first The iterator to the first item to sort
+* @param last The iterator past the last item to sort
+* @param comp The comparator to sort by
+*/
+template <class Iterator, class Compare = std::less<>>
+void heapSort(Iterator first, Iterator last, Compare comp = Compare());
+
+/*
+* Rearranges the given range so [first, middle) holds the middle - first
+* items that come first in ascending order of comp, sorted, like
+* std::partial_sort. Sort by std::greater to get the top k items.
+* Keeps a heap of the k candidates, rejecting items with one comparison,
+* and keeps them sorted by insertion instead when k is HeapSort::INSERTION_CUTOFF
+* or less.
+* @param first The iterator to the first item
+* @param middle The iterator past the last item to sort
+* @param last The iterator past the last item
+* @param comp The comparator to sort by
+*/
+template <class Iterator, class Compare = std::less<>>
+void partialSortTopK(Iterator first, Iterator middle, Iterator last, Compare comp = Compare());
+
+/*
+* HeapSort holds the steps heapSort & partialSortTopK share, kept private
+* so they stay out of the names of every file including this one
+*/
+class HeapSort {
+
+	template <class Iterator, class Compare>
+	friend void heapSort(Iterator first, Iterator last, Compare comp);
+
+	template <class Iterator, class Compare>
+	friend void partialSortTopK(Iterator first, Iterator middle, Iterator last, Compare comp);
+
+	// Ranges this size or smaller are insertion sorted
+	static const int INSERTION_CUTOFF = 16;
+
+	/*
+	* Static method
+	* Insertion sorts the given range in ascending order of comp
+	* @param first The iterator to the first item to sort
+	* @param last The iterator past the last item to sort
+	* @param comp The comparator to sort by
+	*/
+	template <class Iterator, class Compare>
+	static void insertionSort(Iterator first, Iterator last, Compare& comp);
+
+	/*
+	* Static method
+	* Moves the hole at the given node down to a leaf along the larger children,
+	* then sifts item up from the leaf to its position and moves it there
+	* @param first The iterator to the root of the heap
+	* @param size The size of the heap
+	* @param hole The node of the hole
+	* @param item The item to place
+	* @param comp The comparator ordering the heap
+	*/
+	template <class Iterator, class Compare>
+	static void siftBounce(Iterator first, int size, int hole,
+	                       typename std::iterator_traits<Iterator>::value_type item, Compare& comp);
+
+};
+
+#include "heapsort.cpp"
+#endif // HEAPSORT_H
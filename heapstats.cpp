@@ -0,0 +1,227 @@
+#include "heapstats.h"
+/*
+* heapstats.cpp
+*
+* Implementations for HeapStats class
+*
+* @author Juan Arias
+*
+*/
+
+#include <algorithm>
+
+  //**************// //**************// //**************//
+ //*  PUBLIC:   *// //*  PUBLIC:   *// //*  PUBLIC:   *//
+//**************// //**************// //**************//
+
+/*
+* Opens scope
+* @param stats The statistics to record into
+*/
+inline HeapStats::Scope::Scope(HeapStats& stats) :previous(HeapStats::current()) {
+
+	HeapStats::current() = &stats;
+}
+
+/*
+* Closes scope, restoring the statistics recorded into before it
+*/
+inline HeapStats::Scope::~Scope() {
+
+	HeapStats::current() = this->previous;
+}
+
+/*
+* Constructs statistics with every count zero
+*/
+inline HeapStats::HeapStats() {
+
+	this->clear();
+}
+
+/*
+* Add the counts of other statistics to these
+* @param other The other statistics
+*/
+inline void HeapStats::merge(const HeapStats& other) {
+
+	this->adds += other.adds;
+	this->removes += other.removes;
+	this->comparisons += other.comparisons;
+	this->moves += other.moves;
+	this->reallocations += other.reallocations;
+	this->peakSize = std::max(this->peakSize, other.peakSize);
+
+	for (int depth(0); depth < HeapStats::DEPTHS; ++depth) {
+
+		this->depths[depth] += other.depths[depth];
+	}
+}
+
+/*
+* Set every count to zero
+*/
+inline void HeapStats::clear() {
+
+	this->adds = this->removes = 0;
+	this->comparisons = this->moves = 0;
+	this->reallocations = 0;
+	this->peakSize = 0;
+
+	std::fill(this->depths, this->depths + HeapStats::DEPTHS, 0);
+}
+
+/*
+* Get the statistics as a JSON object, the histogram without trailing zeros
+* @return the JSON text
+*/
+inline std::string HeapStats::toJson() const {
+
+	std::string json = "{\"adds\":" + std::to_string(this->adds)
+	                 + ",\"removes\":" + std::to_string(this->removes)
+	                 + ",\"comparisons\":" + std::to_string(this->comparisons)
+	                 + ",\"moves\":" + std::to_string(this->moves)
+	                 + ",\"reallocations\":" + std::to_string(this->reallocations)
+	                 + ",\"peakSize\":" + std::to_string(this->peakSize)
+	                 + ",\"siftDepths\":[";
+
+	int used = HeapStats::DEPTHS;
+
+	while (used > 0 && this->depths[used - 1] == 0) {
+
+		--used;
+	}
+
+	for (int depth(0); depth < used; ++depth) {
+
+		json += (depth > 0 ? "," : "") + std::to_string(this->depths[depth]);
+	}
+
+	return json + "]}";
+}
+
+/*
+* Static method
+* Get the aggregate of every heap's work on this thread
+* @return the statistics of this thread
+*/
+inline HeapStats& HeapStats::local() {
+
+	thread_local HeapStats stats;
+
+	return stats;
+}
+
+/*
+* Static method
+* Records an item added
+* @param size The number of items held after adding
+*/
+inline void HeapStats::add(int size) {
+
+#ifdef HEAP_INSTRUMENT
+	HeapStats::record([size](HeapStats& stats) {
+
+		++stats.adds;
+		stats.peakSize = std::max(stats.peakSize, size);
+	});
+#else
+	(void) size;
+#endif
+}
+
+/*
+* Static method
+* Records an item removed
+*/
+inline void HeapStats::remove() {
+
+#ifdef HEAP_INSTRUMENT
+	HeapStats::record([](HeapStats& stats) { ++stats.removes; });
+#endif
+}
+
+/*
+* Static method
+* Records comparisons
+* @param count The number of comparisons
+*/
+inline void HeapStats::compare(long long count) {
+
+#ifdef HEAP_INSTRUMENT
+	HeapStats::record([count](HeapStats& stats) { stats.comparisons += count; });
+#else
+	(void) count;
+#endif
+}
+
+/*
+* Static method
+* Records item moves
+* @param count The number of moves
+*/
+inline void HeapStats::move(long long count) {
+
+#ifdef HEAP_INSTRUMENT
+	HeapStats::record([count](HeapStats& stats) { stats.moves += count; });
+#else
+	(void) count;
+#endif
+}
+
+/*
+* Static method
+* Records a sift
+* @param depth The number of levels the item moved
+*/
+inline void HeapStats::sift(int depth) {
+
+#ifdef HEAP_INSTRUMENT
+	HeapStats::record([depth](HeapStats& stats) { ++stats.depths[std::min(depth, HeapStats::DEPTHS - 1)]; });
+#else
+	(void) depth;
+#endif
+}
+
+/*
+* Static method
+* Records a reallocation of the array
+*/
+inline void HeapStats::reallocate() {
+
+#ifdef HEAP_INSTRUMENT
+	HeapStats::record([](HeapStats& stats) { ++stats.reallocations; });
+#endif
+}
+
+  //**************// //**************// //**************//
+ //*  PRIVATE:  *// //*  PRIVATE:  *// //*  PRIVATE:  *//
+//**************// //**************// //**************//
+
+/*
+* Static method
+* Gets the statistics of the open Scope on this thread
+* @return the statistics, nullptr if no scope is open
+*/
+inline HeapStats*& HeapStats::current() {
+
+	thread_local HeapStats* stats = nullptr;
+
+	return stats;
+}
+
+/*
+* Static method
+* Applies a recording to this thread's aggregate & the open Scope's statistics
+* @param record The recording, called with each statistics
+*/
+template <class Record>
+void HeapStats::record(const Record& record) {
+
+	record(HeapStats::local());
+
+	if (HeapStats::current() != nullptr) {
+
+		record(*HeapStats::current());
+	}
+}
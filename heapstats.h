@@ -0,0 +1,168 @@
+/*
+* heapstats.h
+*
+* Specifications for HeapStats class
+*
+* @author Juan Arias
+*
+*/
+
+#ifndef HEAPSTATS_H
+#define HEAPSTATS_H
+
+#include <string>
+
+// Heaps count their work only when HEAP_INSTRUMENT is defined, otherwise
+// every recording call is empty & heaps hold no statistics
+#ifdef HEAP_INSTRUMENT
+#define HEAP_SCOPE(stats) HeapStats::Scope heapScope(stats)
+#else
+#define HEAP_SCOPE(stats)
+#endif
+
+/*
+* HeapStats counts the work done by heaps: adds, removes, comparisons &
+* moves made sifting, the depth of each sift, reallocations & peak size.
+* Each thread aggregates the work of every heap it runs in local(), and
+* each heap its own work in getStats() while a Scope is open on it.
+*/
+class HeapStats {
+
+public:
+
+	// Constant for buckets of the sift depth histogram, the last holding deeper sifts too
+	static const int DEPTHS = 32;
+
+	// Items added & removed
+	long long adds, removes;
+
+	// Comparisons & item moves made sifting
+	long long comparisons, moves;
+
+	// Reallocations of the array as it grew
+	long long reallocations;
+
+	// Most items held at once
+	int peakSize;
+
+	// Sifts by the number of levels each moved an item
+	long long depths[DEPTHS];
+
+	/*
+	* Attributes the work recorded on this thread to the given statistics
+	* until destroyed, on top of the thread's aggregate
+	*/
+	class Scope {
+
+	public:
+
+		/*
+		* Opens scope
+		* @param stats The statistics to record into
+		*/
+		explicit Scope(HeapStats& stats);
+
+		/*
+		* Closes scope, restoring the statistics recorded into before it
+		*/
+		~Scope();
+
+		Scope(const Scope&) = delete;
+		Scope& operator=(const Scope&) = delete;
+
+	private:
+
+		// Statistics recorded into before the scope opened
+		HeapStats* previous;
+	};
+
+	/*
+	* Constructs statistics with every count zero
+	*/
+	HeapStats();
+
+	/*
+	* Add the counts of other statistics to these
+	* @param other The other statistics
+	*/
+	void merge(const HeapStats& other);
+
+	/*
+	* Set every count to zero
+	*/
+	void clear();
+
+	/*
+	* Get the statistics as a JSON object, the histogram without trailing zeros
+	* @return the JSON text
+	*/
+	std::string toJson() const;
+
+	/*
+	* Static method
+	* Get the aggregate of every heap's work on this thread
+	* @return the statistics of this thread
+	*/
+	static HeapStats& local();
+
+	/*
+	* Static method
+	* Records an item added
+	* @param size The number of items held after adding
+	*/
+	static void add(int size);
+
+	/*
+	* Static method
+	* Records an item removed
+	*/
+	static void remove();
+
+	/*
+	* Static method
+	* Records comparisons
+	* @param count The number of comparisons
+	*/
+	static void compare(long long count = 1);
+
+	/*
+	* Static method
+	* Records item moves
+	* @param count The number of moves
+	*/
+	static void move(long long count = 1);
+
+	/*
+	* Static method
+	* Records a sift
+	* @param depth The number of levels the item moved
+	*/
+	static void sift(int depth);
+
+	/*
+	* Static method
+	* Records a reallocation of the array
+	*/
+	static void reallocate();
+
+private:
+
+	/*
+	* Static method
+	* Gets the statistics of the open Scope on this thread
+	* @return the statistics, nullptr if no scope is open
+	*/
+	static HeapStats*& current();
+
+	/*
+	* Static method
+	* Applies a recording to this thread's aggregate & the open Scope's statistics
+	* @param record The recording, called with each statistics
+	*/
+	template <class Record>
+	static void record(const Record& record);
+
+};
+
+#include "heapstats.cpp"
+#endif // HEAPSTATS_H
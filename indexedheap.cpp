@@ -0,0 +1,556 @@
+#include "indexedheap.h"
+/*
+* indexedheap.cpp
+*
+* Implementations for IndexedHeap class
+*
+* @author Juan Arias
+*
+*/
+
+#include <algorithm>
+
+  //**************// //**************// //**************//
+ //*  PUBLIC:   *// //*  PUBLIC:   *// //*  PUBLIC:   *//
+//**************// //**************// //**************//
+
+/*
+* Constructs empty heap
+*/
+template <class T, class Compare>
+IndexedHeap<T, Compare>::IndexedHeap() :comp() {}
+
+/*
+* Constructs empty heap ordered by given comparator
+* @param comp The comparator to order the heap by
+*/
+template <class T, class Compare>
+IndexedHeap<T, Compare>::IndexedHeap(const Compare& comp) :comp(comp) {}
+
+/*
+* Copy constructor, handles of other are valid in the copy
+* @param other The other heap to copy
+*/
+template <class T, class Compare>
+IndexedHeap<T, Compare>::IndexedHeap(const IndexedHeap& other) :Heap<T>(), comp(other.comp) {
+
+	(*this) = other;
+}
+
+/*
+* Move constructor, handles of other are valid in this heap
+* @param other The other heap to move from, left empty
+*/
+template <class T, class Compare>
+IndexedHeap<T, Compare>::IndexedHeap(IndexedHeap&& other) noexcept
+	:Heap<T>(std::move(other)), comp(std::move(other.comp)), positions(std::move(other.positions)),
+	 handles(std::move(other.handles)), freed(std::move(other.freed)), generations(std::move(other.generations)) {}
+
+/*
+* Destroys heap and deallocates all dynamic memory
+*/
+template <class T, class Compare>
+IndexedHeap<T, Compare>::~IndexedHeap() {}
+
+/*
+* Assignment operator overload, items get handles in array order
+* @param other The other heap to copy
+* @return this heap by reference
+*/
+template <class T, class Compare>
+Heap<T>& IndexedHeap<T, Compare>::operator=(const Heap<T>& other) {
+
+	if (this != &other) {
+
+		this->Heap<T>::operator=(other);
+
+		this->create();
+	}
+
+	return (*this);
+}
+
+/*
+* Move assignment operator overload, items get handles in array order
+* @param other The other heap to move from, left empty & cleared
+* @return this heap by reference
+*/
+template <class T, class Compare>
+Heap<T>& IndexedHeap<T, Compare>::operator=(Heap<T>&& other) {
+
+	if (this != &other) {
+
+		this->Heap<T>::operator=(std::move(other));
+
+		// Drops what other keeps beside its array, such as an IndexedHeap's handles
+		other.clear();
+
+		this->create();
+	}
+
+	return (*this);
+}
+
+/*
+* Assignment operator, handles of other are valid in this heap
+* @param other The other heap to copy
+* @return this heap by reference
+*/
+template <class T, class Compare>
+IndexedHeap<T, Compare>& IndexedHeap<T, Compare>::operator=(const IndexedHeap& other) {
+
+	if (this != &other) {
+
+		this->Heap<T>::operator=(other);
+
+		this->comp = other.comp;
+		this->positions = other.positions;
+		this->handles = other.handles;
+		this->freed = other.freed;
+		this->generations = other.generations;
+	}
+
+	return (*this);
+}
+
+/*
+* Move assignment operator, handles of other are valid in this heap
+* @param other The other heap to move from, left empty
+* @return this heap by reference
+*/
+template <class T, class Compare>
+IndexedHeap<T, Compare>& IndexedHeap<T, Compare>::operator=(IndexedHeap&& other) noexcept {
+
+	if (this != &other) {
+
+		this->Heap<T>::operator=(std::move(other));
+
+		this->comp = std::move(other.comp);
+		this->positions = std::move(other.positions);
+		this->handles = std::move(other.handles);
+		this->freed = std::move(other.freed);
+		this->generations = std::move(other.generations);
+
+		other.clear();
+	}
+
+	return (*this);
+}
+
+/*
+* Add item to the heap
+* @param item The item to add to the heap
+*/
+template <class T, class Compare>
+void IndexedHeap<T, Compare>::add(const T& item) {
+
+	this->insert(item);
+}
+
+/*
+* Add item to the heap by moving it
+* @param item The item to move into the heap
+*/
+template <class T, class Compare>
+void IndexedHeap<T, Compare>::add(T&& item) {
+
+	this->insert(std::move(item));
+}
+
+/*
+* Add item to the heap
+* @param item The item to add to the heap
+* @return the handle of the item
+*/
+template <class T, class Compare>
+typename IndexedHeap<T, Compare>::Handle IndexedHeap<T, Compare>::insert(const T& item) {
+
+	HEAP_SCOPE(this->stats);
+
+	this->append(item);
+
+	return this->track();
+}
+
+/*
+* Add item to the heap by moving it
+* @param item The item to move into the heap
+* @return the handle of the item
+*/
+template <class T, class Compare>
+typename IndexedHeap<T, Compare>::Handle IndexedHeap<T, Compare>::insert(T&& item) {
+
+	HEAP_SCOPE(this->stats);
+
+	this->append(std::move(item));
+
+	return this->track();
+}
+
+/*
+* Remove the peek item in the heap
+*/
+template <class T, class Compare>
+void IndexedHeap<T, Compare>::remove() {
+
+	if (this->itemCount > Heap<T>::EMPTY) {
+
+		this->erase(this->peekHandle());
+	}
+}
+
+/*
+* Check if item is in the heap by searching every node
+* @param item The item to search for
+* @return true if found, else false
+*/
+template <class T, class Compare>
+bool IndexedHeap<T, Compare>::contains(const T& item) {
+
+	bool found(false);
+
+	if (!this->isEmpty() && !this->comp(this->peek(), item)) {
+
+		for (Node curr(Heap<T>::ROOT); curr < this->itemCount && !found; ++curr) {
+
+			found = (this->arr[curr] == item);
+		}
+	}
+
+	return found;
+}
+
+/*
+* Check if the item of the given handle is in the heap
+* @param handle The handle of the item
+* @return true if found, else false
+*/
+template <class T, class Compare>
+bool IndexedHeap<T, Compare>::contains(Handle handle) const {
+
+	return (handle.id >= 0 && handle.id < static_cast<int>(this->positions.size())
+	        && this->positions[handle.id] != IndexedHeap::NONE
+	        && this->generations[handle.id] == handle.generation);
+}
+
+/*
+* Clear the heap, invalidating every handle
+*/
+template <class T, class Compare>
+void IndexedHeap<T, Compare>::clear() {
+
+	this->retire();
+
+	this->positions.clear();
+	this->handles.clear();
+	this->freed.clear();
+
+	this->Heap<T>::clear();
+}
+
+/*
+* Get the item of the given handle, throws std::invalid_argument if not in the heap
+* @param handle The handle of the item
+* @return the item by const reference
+*/
+template <class T, class Compare>
+const T& IndexedHeap<T, Compare>::get(Handle handle) const {
+
+	return this->arr[this->locate(handle)];
+}
+
+/*
+* Get the handle of the peek item in the heap
+* @return the handle of the peek item
+*/
+template <class T, class Compare>
+typename IndexedHeap<T, Compare>::Handle IndexedHeap<T, Compare>::peekHandle() const {
+
+	if (this->itemCount > Heap<T>::EMPTY) {
+
+		int id = this->handles[Heap<T>::ROOT];
+
+		return Handle{id, this->generations[id]};
+	}
+
+	throw Heap<T>::EMPTY;
+}
+
+/*
+* Replace the item of the given handle and move it to its new position,
+* throws std::invalid_argument if not in the heap
+* @param handle The handle of the item
+* @param item The new item
+*/
+template <class T, class Compare>
+void IndexedHeap<T, Compare>::update(Handle handle, const T& item) {
+
+	HEAP_SCOPE(this->stats);
+
+	Node curr = this->locate(handle);
+
+	this->arr[curr] = item;
+
+	this->fix(curr);
+}
+
+/*
+* Replace the item of the given handle by moving and move it to its new
+* position, throws std::invalid_argument if not in the heap
+* @param handle The handle of the item
+* @param item The new item to move into the heap
+*/
+template <class T, class Compare>
+void IndexedHeap<T, Compare>::update(Handle handle, T&& item) {
+
+	HEAP_SCOPE(this->stats);
+
+	Node curr = this->locate(handle);
+
+	this->arr[curr] = std::move(item);
+
+	this->fix(curr);
+}
+
+/*
+* Remove the item of the given handle from the heap, throws
+* std::invalid_argument if not in the heap
+* @param handle The handle of the item
+*/
+template <class T, class Compare>
+void IndexedHeap<T, Compare>::erase(Handle handle) {
+
+	HEAP_SCOPE(this->stats);
+
+	Node curr = this->locate(handle);
+	Node last = --this->itemCount;
+
+	HeapStats::remove();
+
+	if (curr != last) {
+
+		this->arr[curr] = std::move(this->arr[last]);
+		this->place(curr, this->handles[last]);
+	}
+
+	this->arr[last].~T();
+	this->handles.pop_back();
+
+	this->positions[handle.id] = IndexedHeap::NONE;
+	++this->generations[handle.id];
+	this->freed.push_back(handle.id);
+
+	if (curr != last) {
+
+		this->fix(curr);
+	}
+}
+
+  //**************// //**************// //**************//
+ //*  PRIVATE:  *// //*  PRIVATE:  *// //*  PRIVATE:  *//
+//**************// //**************// //**************//
+
+/*
+* Gives the item constructed at the end of the array a handle and bubbles it up
+* @return the handle of the item
+*/
+template <class T, class Compare>
+typename IndexedHeap<T, Compare>::Handle IndexedHeap<T, Compare>::track() {
+
+	int handle;
+
+	if (this->freed.empty()) {
+
+		handle = static_cast<int>(this->positions.size());
+		this->positions.push_back(IndexedHeap::NONE);
+
+		// Ids past positions kept their generations through clear
+		if (handle == static_cast<int>(this->generations.size())) {
+
+			this->generations.push_back(0);
+		}
+
+	} else {
+
+		handle = this->freed.back();
+		this->freed.pop_back();
+	}
+
+	Node curr = this->itemCount - 1;
+
+	this->handles.push_back(handle);
+	this->place(curr, handle);
+
+	this->bubbleUp(curr);
+
+	return Handle{handle, this->generations[handle]};
+}
+
+/*
+* Gives every item a handle in array order and forms heap
+*/
+template <class T, class Compare>
+void IndexedHeap<T, Compare>::create() {
+
+	HEAP_SCOPE(this->stats);
+
+	this->retire();
+
+	if (static_cast<int>(this->generations.size()) < this->itemCount) {
+
+		this->generations.resize(this->itemCount, 0);
+	}
+
+	this->positions.resize(this->itemCount);
+	this->handles.resize(this->itemCount);
+	this->freed.clear();
+
+	for (Node curr(Heap<T>::ROOT); curr < this->itemCount; ++curr) {
+
+		this->place(curr, curr);
+	}
+
+	for (Node curr(this->itemCount / 2); curr >= Heap<T>::ROOT; --curr) {
+
+		this->rebuild(curr);
+	}
+}
+
+/*
+* Gets the node of the given handle's item
+* @param handle The handle of the item
+* @return the node, throws std::invalid_argument if not in the heap
+*/
+template <class T, class Compare>
+Node IndexedHeap<T, Compare>::locate(Handle handle) const {
+
+	if (!this->contains(handle)) {
+
+		throw std::invalid_argument("IndexedHeap handle not in the heap");
+	}
+
+	return this->positions[handle.id];
+}
+
+/*
+* Invalidates the handles of every item ever in the heap
+*/
+template <class T, class Compare>
+void IndexedHeap<T, Compare>::retire() {
+
+	for (std::uint32_t& generation : this->generations) {
+
+		++generation;
+	}
+}
+
+/*
+* Stores the given handle in the given node
+* @param curr The node the handle's item is in
+* @param handle The handle of the item
+*/
+template <class T, class Compare>
+void IndexedHeap<T, Compare>::place(Node curr, int handle) {
+
+	this->handles[curr] = handle;
+	this->positions[handle] = curr;
+}
+
+/*
+* Moves node up or down the heap until in correct position
+* @param curr The current node in the heap
+*/
+template <class T, class Compare>
+void IndexedHeap<T, Compare>::fix(Node curr) {
+
+	if (curr > Heap<T>::ROOT) {
+
+		HeapStats::compare();
+
+		if (this->comp(this->arr[Heap<T>::parent(curr)], this->arr[curr])) {
+
+			this->bubbleUp(curr);
+			return;
+		}
+	}
+
+	this->rebuild(curr);
+}
+
+/*
+* Bubbles node up heap until in correct position
+* @param curr The current node in the heap
+*/
+template <class T, class Compare>
+void IndexedHeap<T, Compare>::bubbleUp(Node curr) {
+
+	T item = std::move(this->arr[curr]);
+	int handle = this->handles[curr];
+	int depth(0), comparisons(0);
+
+	while (curr > Heap<T>::ROOT) {
+
+		Node parent = Heap<T>::parent(curr);
+
+		++comparisons;
+
+		if (!this->comp(this->arr[parent], item)) {
+
+			break;
+		}
+
+		this->arr[curr] = std::move(this->arr[parent]);
+		this->place(curr, this->handles[parent]);
+		curr = parent;
+		++depth;
+	}
+
+	this->arr[curr] = std::move(item);
+	this->place(curr, handle);
+
+	HeapStats::compare(comparisons);
+	HeapStats::move(depth + 2);
+	HeapStats::sift(depth);
+}
+
+/*
+* Trickles nodes down heap until in correct position
+* @param curr The current node in the heap
+*/
+template <class T, class Compare>
+void IndexedHeap<T, Compare>::rebuild(Node curr) {
+
+	if (Heap<T>::isLeaf(curr, this->itemCount)) {
+
+		return;
+	}
+
+	T item = std::move(this->arr[curr]);
+	int handle = this->handles[curr];
+	int depth(0), comparisons(0);
+
+	while (!Heap<T>::isLeaf(curr, this->itemCount)) {
+
+		Node larger = Heap<T>::largerChild(this->arr, this->itemCount, curr, this->comp);
+
+		// Picking the larger of the children & comparing the item with it
+		comparisons += std::min(2, this->itemCount - Heap<T>::left(curr));
+
+		if (!this->comp(item, this->arr[larger])) {
+
+			break;
+		}
+
+		this->arr[curr] = std::move(this->arr[larger]);
+		this->place(curr, this->handles[larger]);
+		curr = larger;
+		++depth;
+	}
+
+	this->arr[curr] = std::move(item);
+	this->place(curr, handle);
+
+	HeapStats::compare(comparisons);
+	HeapStats::move(depth + 2);
+	HeapStats::sift(depth);
+}
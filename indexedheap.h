@@ -0,0 +1,248 @@
+/*
+* indexedheap.h
+*
+* Specifications for IndexedHeap class
+*
+* @author Juan Arias
+*
+*/
+
+#ifndef INDEXEDHEAP_H
+#define INDEXEDHEAP_H
+
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+#include "heap.h"
+
+/*
+* An IndexedHeap is an implementation of the Heap interface that hands out a
+* stable Handle for every inserted item and tracks the node each handle is in,
+* so items can be found, updated or erased in O(log n) without searching.
+*/
+template <class T, class Compare = std::less<T>>
+class IndexedHeap final : public Heap<T> {
+
+public:
+
+	// Reference to an item in the heap, valid until the item is removed: ids
+	// are reused, so a removed item's handle is told apart by its generation,
+	// unsigned so it wraps once an id is reused 2^32 times
+	struct Handle {
+
+		int id;
+		std::uint32_t generation;
+	};
+
+	/*
+	* Constructs empty heap
+	*/
+	IndexedHeap();
+
+	/*
+	* Constructs empty heap ordered by given comparator
+	* @param comp The comparator to order the heap by
+	*/
+	explicit IndexedHeap(const Compare& comp);
+
+	/*
+	* Copy constructor, handles of other are valid in the copy
+	* @param other The other heap to copy
+	*/
+	IndexedHeap(const IndexedHeap& other);
+
+	/*
+	* Move constructor, handles of other are valid in this heap
+	* @param other The other heap to move from, left empty
+	*/
+	IndexedHeap(IndexedHeap&& other) noexcept;
+
+	/*
+	* Destroys heap and deallocates all dynamic memory
+	*/
+	virtual ~IndexedHeap();
+
+	/*
+	* Assignment operator overload, items get handles in array order
+	* @param other The other heap to copy
+	* @return this heap by reference
+	*/
+	Heap<T>& operator=(const Heap<T>& other) override;
+
+	/*
+	* Move assignment operator overload, items get handles in array order
+	* @param other The other heap to move from, left empty & cleared
+	* @return this heap by reference
+	*/
+	Heap<T>& operator=(Heap<T>&& other) override;
+
+	/*
+	* Assignment operator, handles of other are valid in this heap
+	* @param other The other heap to copy
+	* @return this heap by reference
+	*/
+	IndexedHeap& operator=(const IndexedHeap& other);
+
+	/*
+	* Move assignment operator, handles of other are valid in this heap
+	* @param other The other heap to move from, left empty
+	* @return this heap by reference
+	*/
+	IndexedHeap& operator=(IndexedHeap&& other) noexcept;
+
+	/*
+	* Add item to the heap
+	* @param item The item to add to the heap
+	*/
+	void add(const T& item) override;
+
+	/*
+	* Add item to the heap by moving it
+	* @param item The item to move into the heap
+	*/
+	void add(T&& item) override;
+
+	/*
+	* Add item to the heap
+	* @param item The item to add to the heap
+	* @return the handle of the item
+	*/
+	Handle insert(const T& item);
+
+	/*
+	* Add item to the heap by moving it
+	* @param item The item to move into the heap
+	* @return the handle of the item
+	*/
+	Handle insert(T&& item);
+
+	/*
+	* Remove the peek item in the heap
+	*/
+	void remove() override;
+
+	/*
+	* Check if item is in the heap by searching every node
+	* @param item The item to search for
+	* @return true if found, else false
+	*/
+	bool contains(const T& item) override;
+
+	/*
+	* Check if the item of the given handle is in the heap
+	* @param handle The handle of the item
+	* @return true if found, else false
+	*/
+	bool contains(Handle handle) const;
+
+	/*
+	* Clear the heap, invalidating every handle
+	*/
+	void clear() override;
+
+	/*
+	* Get the item of the given handle, throws std::invalid_argument if not in the heap
+	* @param handle The handle of the item
+	* @return the item by const reference
+	*/
+	const T& get(Handle handle) const;
+
+	/*
+	* Get the handle of the peek item in the heap
+	* @return the handle of the peek item
+	*/
+	Handle peekHandle() const;
+
+	/*
+	* Replace the item of the given handle and move it to its new position,
+	* throws std::invalid_argument if not in the heap
+	* @param handle The handle of the item
+	* @param item The new item
+	*/
+	void update(Handle handle, const T& item);
+
+	/*
+	* Replace the item of the given handle by moving and move it to its new
+	* position, throws std::invalid_argument if not in the heap
+	* @param handle The handle of the item
+	* @param item The new item to move into the heap
+	*/
+	void update(Handle handle, T&& item);
+
+	/*
+	* Remove the item of the given handle from the heap, throws
+	* std::invalid_argument if not in the heap
+	* @param handle The handle of the item
+	*/
+	void erase(Handle handle);
+
+private:
+
+	// Comparator ordering the heap, comp(a, b) is true if b has priority
+	Compare comp;
+
+	// Node of every handle (NONE if free) & handle of every node
+	std::vector<Node> positions;
+	std::vector<int> handles;
+
+	// Handles of removed items, reused by insert
+	std::vector<int> freed;
+
+	// Generation of every handle id, bumped when its item is removed
+	std::vector<std::uint32_t> generations;
+
+	// Constant for position of a free handle
+	static constexpr Node NONE = -1;
+
+	/*
+	* Gives the item constructed at the end of the array a handle and bubbles it up
+	* @return the handle of the item
+	*/
+	Handle track();
+
+	/*
+	* Gives every item a handle in array order and forms heap
+	*/
+	void create();
+
+	/*
+	* Gets the node of the given handle's item
+	* @param handle The handle of the item
+	* @return the node, throws std::invalid_argument if not in the heap
+	*/
+	Node locate(Handle handle) const;
+
+	/*
+	* Invalidates the handles of every item ever in the heap
+	*/
+	void retire();
+
+	/*
+	* Stores the given handle in the given node
+	* @param curr The node the handle's item is in
+	* @param handle The handle of the item
+	*/
+	void place(Node curr, int handle);
+
+	/*
+	* Moves node up or down the heap until in correct position
+	* @param curr The current node in the heap
+	*/
+	void fix(Node curr);
+
+	/*
+	* Bubbles node up heap until in correct position
+	* @param curr The current node in the heap
+	*/
+	void bubbleUp(Node curr);
+
+	/*
+	* Trickles nodes down heap until in correct position
+	* @param curr The current node in the heap
+	*/
+	void rebuild(Node curr);
+
+};
+#include "indexedheap.cpp"
+#endif // INDEXEDHEAP_H
@@ -0,0 +1,209 @@
+#include "keyedheap.h"
+/*
+* keyedheap.cpp
+*
+* Implementations for KeyedHeap class
+*
+* @author Juan Arias
+*
+*/
+
+  //**************// //**************// //**************//
+ //*  PUBLIC:   *// //*  PUBLIC:   *// //*  PUBLIC:   *//
+//**************// //**************// //**************//
+
+/*
+* Constructs empty heap
+*/
+template <class Key, class Value, class Compare>
+KeyedHeap<Key, Value, Compare>::KeyedHeap() :KeyedHeap(Compare()) {}
+
+/*
+* Constructs empty heap ordered by given comparator
+* @param comp The comparator to order the keys by
+*/
+template <class Key, class Value, class Compare>
+KeyedHeap<Key, Value, Compare>::KeyedHeap(const Compare& comp) :keys(EntryCompare{comp}) {}
+
+/*
+* Add item to the heap
+* @param key The key to order the item by
+* @param value The value of the item
+*/
+template <class Key, class Value, class Compare>
+void KeyedHeap<Key, Value, Compare>::add(const Key& key, const Value& value) {
+
+	this->insert(key, value);
+}
+
+/*
+* Add item to the heap by moving its value
+* @param key The key to order the item by
+* @param value The value of the item to move into the heap
+*/
+template <class Key, class Value, class Compare>
+void KeyedHeap<Key, Value, Compare>::add(const Key& key, Value&& value) {
+
+	this->insert(key, std::move(value));
+}
+
+/*
+* Remove the peek item in the heap
+*/
+template <class Key, class Value, class Compare>
+void KeyedHeap<Key, Value, Compare>::remove() {
+
+	if (!this->keys.isEmpty()) {
+
+		this->release(this->keys.pop().slot);
+	}
+}
+
+/*
+* Remove the peek item in the heap and return it
+* @return the key & value of the peek item, moved out of the heap
+*/
+template <class Key, class Value, class Compare>
+typename KeyedHeap<Key, Value, Compare>::Item KeyedHeap<Key, Value, Compare>::pop() {
+
+	Entry top = this->keys.pop();
+
+	Item item(std::move(top.key), std::move(this->values[top.slot]));
+
+	this->release(top.slot);
+
+	return item;
+}
+
+/*
+* Get the key of the peek item in the heap
+* @return the key of the peek item
+*/
+template <class Key, class Value, class Compare>
+const Key& KeyedHeap<Key, Value, Compare>::peekKey() const {
+
+	return this->keys.peek().key;
+}
+
+/*
+* Get the value of the peek item in the heap
+* @return the value of the peek item
+*/
+template <class Key, class Value, class Compare>
+Value& KeyedHeap<Key, Value, Compare>::peekValue() {
+
+	return this->values[this->keys.peek().slot];
+}
+
+/*
+* Get the value of the peek item in the heap
+* @return the value of the peek item
+*/
+template <class Key, class Value, class Compare>
+const Value& KeyedHeap<Key, Value, Compare>::peekValue() const {
+
+	return this->values[this->keys.peek().slot];
+}
+
+/*
+* Reserve room for keys, so adding up to capacity items sifts without growing
+* @param capacity The number of items to reserve room for
+*/
+template <class Key, class Value, class Compare>
+void KeyedHeap<Key, Value, Compare>::reserve(int capacity) {
+
+	this->keys.reserve(capacity);
+}
+
+/*
+* Check if heap is empty
+* @return true if empty, else false
+*/
+template <class Key, class Value, class Compare>
+bool KeyedHeap<Key, Value, Compare>::isEmpty() const {
+
+	return this->keys.isEmpty();
+}
+
+/*
+* Get the number of nodes in the heap
+* @return the number of nodes in the heap
+*/
+template <class Key, class Value, class Compare>
+int KeyedHeap<Key, Value, Compare>::getNodes() const {
+
+	return this->keys.getNodes();
+}
+
+/*
+* Clear the heap
+*/
+template <class Key, class Value, class Compare>
+void KeyedHeap<Key, Value, Compare>::clear() {
+
+	this->keys.clear();
+	this->values.clear();
+	this->freeSlots.clear();
+}
+
+  //**************// //**************// //**************//
+ //*  PRIVATE:  *// //*  PRIVATE:  *// //*  PRIVATE:  *//
+//**************// //**************// //**************//
+
+/*
+* Adds item to the heap
+* @param key The key to order the item by
+* @param value The value of the item, forwarded into its slot
+*/
+template <class Key, class Value, class Compare>
+template <class V>
+void KeyedHeap<Key, Value, Compare>::insert(const Key& key, V&& value) {
+
+	bool reused = !this->freeSlots.empty();
+	int slot = reused ? this->freeSlots.back() : static_cast<int>(this->values.size());
+
+	if (reused) {
+
+		this->values[slot] = std::forward<V>(value);
+
+	} else {
+
+		this->values.push_back(std::forward<V>(value));
+	}
+
+	try {
+
+		this->keys.add(Entry{key, slot});
+
+	} catch (...) {
+
+		// A reused slot stays free, reset for the next item to overwrite
+		if (reused) {
+
+			this->values[slot] = Value();
+
+		} else {
+
+			this->values.pop_back();
+		}
+
+		throw;
+	}
+
+	if (reused) {
+
+		this->freeSlots.pop_back();
+	}
+}
+
+/*
+* Frees a slot for reuse, resetting its value so nothing the value owns
+* outlives its item
+* @param slot The slot to free
+*/
+template <class Key, class Value, class Compare>
+void KeyedHeap<Key, Value, Compare>::release(int slot) {
+
+	this->values[slot] = Value();
+	this->freeSlots.push_back(slot);
+}
@@ -0,0 +1,157 @@
+/*
+* keyedheap.h
+*
+* Specifications for KeyedHeap class
+*
+* @author Juan Arias
+*
+*/
+
+#ifndef KEYEDHEAP_H
+#define KEYEDHEAP_H
+
+#include <deque>
+#include <functional>
+#include <utility>
+#include <vector>
+#include "basicheap.h"
+
+/*
+* A KeyedHeap is a heap of values ordered by separate keys, for values too
+* large to sift cheaply. Keys are sifted in a dense BasicHeap of key & slot
+* pairs, while values wait in a slab by slot, so a value is moved once when
+* added & once when popped, and sifting never touches it. A freed slot holds
+* a default constructed Value until reused.
+*/
+template <class Key, class Value, class Compare = std::less<Key>>
+class KeyedHeap {
+
+public:
+
+	// Type definition for items popped from the heap
+	using Item = std::pair<Key, Value>;
+
+	/*
+	* Constructs empty heap
+	*/
+	KeyedHeap();
+
+	/*
+	* Constructs empty heap ordered by given comparator
+	* @param comp The comparator to order the keys by
+	*/
+	explicit KeyedHeap(const Compare& comp);
+
+	/*
+	* Add item to the heap
+	* @param key The key to order the item by
+	* @param value The value of the item
+	*/
+	void add(const Key& key, const Value& value);
+
+	/*
+	* Add item to the heap by moving its value
+	* @param key The key to order the item by
+	* @param value The value of the item to move into the heap
+	*/
+	void add(const Key& key, Value&& value);
+
+	/*
+	* Remove the peek item in the heap
+	*/
+	void remove();
+
+	/*
+	* Remove the peek item in the heap and return it
+	* @return the key & value of the peek item, moved out of the heap
+	*/
+	Item pop();
+
+	/*
+	* Get the key of the peek item in the heap
+	* @return the key of the peek item
+	*/
+	const Key& peekKey() const;
+
+	/*
+	* Get the value of the peek item in the heap
+	* @return the value of the peek item
+	*/
+	Value& peekValue();
+
+	/*
+	* Get the value of the peek item in the heap
+	* @return the value of the peek item
+	*/
+	const Value& peekValue() const;
+
+	/*
+	* Reserve room for keys, so adding up to capacity items sifts without growing
+	* @param capacity The number of items to reserve room for
+	*/
+	void reserve(int capacity);
+
+	/*
+	* Check if heap is empty
+	* @return true if empty, else false
+	*/
+	bool isEmpty() const;
+
+	/*
+	* Get the number of nodes in the heap
+	* @return the number of nodes in the heap
+	*/
+	int getNodes() const;
+
+	/*
+	* Clear the heap
+	*/
+	void clear();
+
+private:
+
+	// Key of an item & the slot of its value
+	struct Entry {
+
+		Key key;
+		int slot;
+
+		bool operator==(const Entry& other) const { return this->slot == other.slot; }
+	};
+
+	// Comparator ordering entries by their keys
+	struct EntryCompare {
+
+		Compare comp;
+
+		bool operator()(const Entry& entry1, const Entry& entry2) const { return this->comp(entry1.key, entry2.key); }
+	};
+
+	// Keys of the items, sifted without their values
+	BasicHeap<Entry, EntryCompare> keys;
+
+	// Values by slot, never relocated as the slab grows
+	std::deque<Value> values;
+
+	// Slots whose values were popped, reused before the slab grows
+	std::vector<int> freeSlots;
+
+	/*
+	* Adds item to the heap
+	* @param key The key to order the item by
+	* @param value The value of the item, forwarded into its slot
+	*/
+	template <class V>
+	void insert(const Key& key, V&& value);
+
+	/*
+	* Frees a slot for reuse, resetting its value so nothing the value owns
+	* outlives its item
+	* @param slot The slot to free
+	*/
+	void release(int slot);
+
+};
+
+#include "keyedheap.cpp"
+#endif // KEYEDHEAP_H
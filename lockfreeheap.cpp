@@ -0,0 +1,479 @@
+#include "lockfreeheap.h"
+/*
+* lockfreeheap.cpp
+*
+* Implementations for LockFreeHeap class
+*
+* @author Juan Arias
+*
+*/
+
+#include <new>
+#include <utility>
+
+  //**************// //**************// //**************//
+ //*  PUBLIC:   *// //*  PUBLIC:   *// //*  PUBLIC:   *//
+//**************// //**************// //**************//
+
+/*
+* Constructs empty heap
+*/
+template <class T, class Compare>
+LockFreeHeap<T, Compare>::LockFreeHeap() :LockFreeHeap(Compare()) {}
+
+/*
+* Constructs empty heap ordered by given comparator
+* @param comp The comparator to order the heap by
+*/
+template <class T, class Compare>
+LockFreeHeap<T, Compare>::LockFreeHeap(const Compare& comp)
+	:head(LockFreeHeap::allocate(LockFreeHeap::LEVELS)), tail(LockFreeHeap::allocate(LockFreeHeap::LEVELS)),
+	 comp(comp) {
+
+	this->head->inserting.store(false);
+	this->tail->inserting.store(false);
+
+	for (int i(0); i < LockFreeHeap::LEVELS; ++i) {
+
+		this->head->next()[i].store(reinterpret_cast<Link>(this->tail));
+	}
+}
+
+/*
+* Destroys heap and deallocates all dynamic memory, no thread may be using it
+*/
+template <class T, class Compare>
+LockFreeHeap<T, Compare>::~LockFreeHeap() {
+
+	Node* curr = LockFreeHeap::node(this->head->next()[0].load());
+
+	while (curr != this->tail) {
+
+		Node* next = LockFreeHeap::node(curr->next()[0].load());
+
+		LockFreeHeap::destroy(curr);
+		curr = next;
+	}
+
+	::operator delete(this->head, std::align_val_t(alignof(Node)));
+	::operator delete(this->tail, std::align_val_t(alignof(Node)));
+}
+
+/*
+* Add item to the heap
+* @param item The item to add to the heap
+*/
+template <class T, class Compare>
+void LockFreeHeap<T, Compare>::add(const T& item) {
+
+	Node* node = LockFreeHeap::allocate(LockFreeHeap::randomHeight());
+
+	new (node->storage) T(item);
+
+	this->insert(node);
+}
+
+/*
+* Add item to the heap by moving it
+* @param item The item to move into the heap
+*/
+template <class T, class Compare>
+void LockFreeHeap<T, Compare>::add(T&& item) {
+
+	Node* node = LockFreeHeap::allocate(LockFreeHeap::randomHeight());
+
+	new (node->storage) T(std::move(item));
+
+	this->insert(node);
+}
+
+/*
+* Remove the peek item in the heap
+*/
+template <class T, class Compare>
+void LockFreeHeap<T, Compare>::remove() {
+
+	Epoch::Guard guard;
+
+	this->take();
+}
+
+/*
+* Remove the peek item in the heap
+* @param item Set to the removed item
+* @return true if removed, false if the heap was empty
+*/
+template <class T, class Compare>
+bool LockFreeHeap<T, Compare>::tryPop(T& item) {
+
+	Epoch::Guard guard;
+
+	Node* taken = this->take();
+
+	if (taken != nullptr) {
+
+		// Other threads may still compare against the item, so it is copied
+		item = taken->item();
+	}
+
+	return taken != nullptr;
+}
+
+/*
+* Get the peek item in the heap
+* @return a copy of the peek item, as other threads may remove it
+*/
+template <class T, class Compare>
+T LockFreeHeap<T, Compare>::peek() const {
+
+	Epoch::Guard guard;
+
+	Node* first = this->first();
+
+	if (first == this->tail) {
+
+		throw LockFreeHeap::EMPTY;
+	}
+
+	return first->item();
+}
+
+/*
+* Check if item is in the heap
+* @param item The item to search for
+* @return true if found, else false
+*/
+template <class T, class Compare>
+bool LockFreeHeap<T, Compare>::contains(const T& item) const {
+
+	Epoch::Guard guard;
+
+	bool found(false);
+
+	// Nodes are in priority order, so the search stops at lower priority items
+	for (Node* curr = this->first(); curr != this->tail && !found && !this->comp(curr->item(), item);
+	     curr = LockFreeHeap::node(curr->next()[0].load())) {
+
+		found = (curr->item() == item);
+	}
+
+	return found;
+}
+
+/*
+* Check if the heap is empty
+* @return true if empty, else false
+*/
+template <class T, class Compare>
+bool LockFreeHeap<T, Compare>::isEmpty() const {
+
+	Epoch::Guard guard;
+
+	return this->first() == this->tail;
+}
+
+  //**************// //**************// //**************//
+ //*  PRIVATE:  *// //*  PRIVATE:  *// //*  PRIVATE:  *//
+//**************// //**************// //**************//
+
+/*
+* Static method
+* Allocates a node with the given height, its links null
+* @param height The number of levels the node is linked in
+* @return the node, without an item
+*/
+template <class T, class Compare>
+typename LockFreeHeap<T, Compare>::Node* LockFreeHeap<T, Compare>::allocate(int height) {
+
+	static_assert(sizeof(Node) % alignof(std::atomic<Link>) == 0, "links must follow the node aligned");
+
+	void* memory = ::operator new(sizeof(Node) + height * sizeof(std::atomic<Link>), std::align_val_t(alignof(Node)));
+
+	Node* node = new (memory) Node;
+
+	node->height = height;
+	node->inserting.store(true);
+
+	for (int i(0); i < height; ++i) {
+
+		new (&node->next()[i]) std::atomic<Link>(0);
+	}
+
+	return node;
+}
+
+/*
+* Static method
+* Destroys the item of a node & deallocates it, given to Epoch::retire
+* @param node The node
+*/
+template <class T, class Compare>
+void LockFreeHeap<T, Compare>::destroy(void* node) {
+
+	static_cast<Node*>(node)->item().~T();
+
+	::operator delete(node, std::align_val_t(alignof(Node)));
+}
+
+/*
+* Static method
+* Gets a random height, 1 with probability 1/2, 2 with 1/4 & so on
+* @return the height
+*/
+template <class T, class Compare>
+int LockFreeHeap<T, Compare>::randomHeight() {
+
+	// xorshift, seeded by the address of the thread's own state
+	thread_local std::uint32_t state(0);
+
+	if (state == 0) {
+
+		state = static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(&state) >> 4) | 1;
+	}
+
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+
+	int height(1);
+
+	for (std::uint32_t bits = state; (bits & 1) != 0 && height < LockFreeHeap::LEVELS; bits >>= 1) {
+
+		++height;
+	}
+
+	return height;
+}
+
+/*
+* Static method
+* Gets the node a link points to
+* @param link The link
+* @return the node
+*/
+template <class T, class Compare>
+typename LockFreeHeap<T, Compare>::Node* LockFreeHeap<T, Compare>::node(Link link) {
+
+	return reinterpret_cast<Node*>(link & ~LockFreeHeap::MARK);
+}
+
+/*
+* Static method
+* Checks if a link marks the node it points to deleted
+* @param link The link
+* @return true if marked, else false
+*/
+template <class T, class Compare>
+bool LockFreeHeap<T, Compare>::marked(Link link) {
+
+	return (link & LockFreeHeap::MARK) != 0;
+}
+
+/*
+* Links an allocated node with an item into the skiplist
+* @param node The node to insert
+*/
+template <class T, class Compare>
+void LockFreeHeap<T, Compare>::insert(Node* node) {
+
+	Epoch::Guard guard;
+
+	Node* preds[LockFreeHeap::LEVELS];
+	Node* succs[LockFreeHeap::LEVELS];
+	Node* deleted;
+	Link expected;
+
+	// The bottom level decides membership, it never links into the deleted prefix
+	do {
+
+		deleted = this->locate(node->item(), preds, succs);
+		expected = reinterpret_cast<Link>(succs[0]);
+
+		node->next()[0].store(expected);
+
+	} while (!preds[0]->next()[0].compare_exchange_strong(expected, reinterpret_cast<Link>(node)));
+
+	// Upper levels only speed up searches, give up once the node or its successor is deleted
+	for (int i(1); i < node->height;) {
+
+		node->next()[i].store(reinterpret_cast<Link>(succs[i]));
+
+		if (LockFreeHeap::marked(node->next()[0].load()) || LockFreeHeap::marked(succs[i]->next()[0].load())
+		    || succs[i] == deleted) {
+
+			break;
+		}
+
+		expected = reinterpret_cast<Link>(succs[i]);
+
+		if (preds[i]->next()[i].compare_exchange_strong(expected, reinterpret_cast<Link>(node))) {
+
+			++i;
+
+		} else {
+
+			deleted = this->locate(node->item(), preds, succs);
+
+			if (succs[0] != node) {
+
+				break;
+			}
+		}
+	}
+
+	node->inserting.store(false);
+}
+
+/*
+* Marks the first live node deleted and unlinks the deleted prefix once long enough,
+* the caller must hold an Epoch::Guard
+* @return the deleted node, nullptr if the heap was empty
+*/
+template <class T, class Compare>
+typename LockFreeHeap<T, Compare>::Node* LockFreeHeap<T, Compare>::take() {
+
+	Node* curr = this->head;
+	Node* newHead = nullptr;
+	Link observed = this->head->next()[0].load();
+	Link next;
+	int offset(0);
+
+	// Walks the deleted prefix, the first unmarked link is claimed by the fetch-or
+	do {
+
+		next = curr->next()[0].load();
+
+		if (LockFreeHeap::node(next) == this->tail) {
+
+			return nullptr;
+		}
+
+		// Nodes still being linked in upper levels must stay reachable
+		if (newHead == nullptr && curr->inserting.load()) {
+
+			newHead = curr;
+		}
+
+		next = curr->next()[0].fetch_or(LockFreeHeap::MARK);
+		++offset;
+		curr = LockFreeHeap::node(next);
+
+	} while (LockFreeHeap::marked(next));
+
+	if (newHead == nullptr) {
+
+		newHead = curr;
+	}
+
+	if (offset > LockFreeHeap::BOUND_OFFSET
+	    && this->head->next()[0].compare_exchange_strong(observed, reinterpret_cast<Link>(newHead) | LockFreeHeap::MARK)) {
+
+		this->restructure();
+
+		Node* unlinked = LockFreeHeap::node(observed);
+
+		while (unlinked != newHead) {
+
+			Node* following = LockFreeHeap::node(unlinked->next()[0].load());
+
+			Epoch::retire(unlinked, &LockFreeHeap::destroy);
+			unlinked = following;
+		}
+	}
+
+	return curr;
+}
+
+/*
+* Finds the nodes before & after where item belongs in every level
+* @param item The item to find the position of
+* @param preds Set to the node before the position in each level
+* @param succs Set to the node after the position in each level
+* @return the last deleted node passed in the bottom level, nullptr if none
+*/
+template <class T, class Compare>
+typename LockFreeHeap<T, Compare>::Node* LockFreeHeap<T, Compare>::locate(const T& item, Node* preds[],
+                                                                           Node* succs[]) const {
+
+	Node* curr = this->head;
+	Node* deleted = nullptr;
+
+	for (int i(LockFreeHeap::LEVELS - 1); i >= 0;) {
+
+		Link link = curr->next()[i].load();
+		Node* next = LockFreeHeap::node(link);
+
+		// Passes higher priority items & deleted nodes, the bottom level marks them in the link
+		bool passed = (i == 0 && LockFreeHeap::marked(link));
+
+		if (next != this->tail
+		    && (passed || this->comp(item, next->item()) || LockFreeHeap::marked(next->next()[0].load()))) {
+
+			if (passed) {
+
+				deleted = next;
+			}
+
+			curr = next;
+
+		} else {
+
+			preds[i] = curr;
+			succs[i] = next;
+			--i;
+		}
+	}
+
+	return deleted;
+}
+
+/*
+* Gets the first node not deleted
+* @return the first live node, tail if empty
+*/
+template <class T, class Compare>
+typename LockFreeHeap<T, Compare>::Node* LockFreeHeap<T, Compare>::first() const {
+
+	Link link = this->head->next()[0].load();
+
+	while (LockFreeHeap::marked(link)) {
+
+		link = LockFreeHeap::node(link)->next()[0].load();
+	}
+
+	return LockFreeHeap::node(link);
+}
+
+/*
+* Moves the upper links of head past deleted nodes
+*/
+template <class T, class Compare>
+void LockFreeHeap<T, Compare>::restructure() {
+
+	Node* pred = this->head;
+
+	for (int i(LockFreeHeap::LEVELS - 1); i > 0;) {
+
+		Link link = this->head->next()[i].load();
+		Node* first = LockFreeHeap::node(link);
+
+		if (first == this->tail || !LockFreeHeap::marked(first->next()[0].load())) {
+
+			--i;
+			continue;
+		}
+
+		Node* curr = LockFreeHeap::node(pred->next()[i].load());
+
+		while (curr != this->tail && LockFreeHeap::marked(curr->next()[0].load())) {
+
+			pred = curr;
+			curr = LockFreeHeap::node(pred->next()[i].load());
+		}
+
+		if (this->head->next()[i].compare_exchange_strong(link, pred->next()[i].load())) {
+
+			--i;
+		}
+	}
+}
@@ -0,0 +1,198 @@
+/*
+* lockfreeheap.h
+*
+* Specifications for LockFreeHeap class
+*
+* @author Juan Arias
+*
+*/
+
+#ifndef LOCKFREEHEAP_H
+#define LOCKFREEHEAP_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include "epoch.h"
+
+/*
+* A LockFreeHeap is a lock-free priority queue safe to share between threads,
+* with the add, remove, peek & contains surface of the Heap interface. It is a
+* skiplist kept in priority order (Linden & Jonsson, 2013): remove marks the
+* first live node deleted with one atomic fetch-or, and the deleted prefix is
+* unlinked in batches once it grows past BOUND_OFFSET nodes. Unlinked nodes
+* are reclaimed through Epoch.
+*/
+template <class T, class Compare = std::less<T>>
+class LockFreeHeap {
+
+public:
+
+	/*
+	* Constructs empty heap
+	*/
+	LockFreeHeap();
+
+	/*
+	* Constructs empty heap ordered by given comparator
+	* @param comp The comparator to order the heap by
+	*/
+	explicit LockFreeHeap(const Compare& comp);
+
+	LockFreeHeap(const LockFreeHeap& other) = delete;
+	LockFreeHeap& operator=(const LockFreeHeap& other) = delete;
+
+	/*
+	* Destroys heap and deallocates all dynamic memory, no thread may be using it
+	*/
+	~LockFreeHeap();
+
+	/*
+	* Add item to the heap
+	* @param item The item to add to the heap
+	*/
+	void add(const T& item);
+
+	/*
+	* Add item to the heap by moving it
+	* @param item The item to move into the heap
+	*/
+	void add(T&& item);
+
+	/*
+	* Remove the peek item in the heap
+	*/
+	void remove();
+
+	/*
+	* Remove the peek item in the heap
+	* @param item Set to the removed item
+	* @return true if removed, false if the heap was empty
+	*/
+	bool tryPop(T& item);
+
+	/*
+	* Get the peek item in the heap
+	* @return a copy of the peek item, as other threads may remove it
+	*/
+	T peek() const;
+
+	/*
+	* Check if item is in the heap
+	* @param item The item to search for
+	* @return true if found, else false
+	*/
+	bool contains(const T& item) const;
+
+	/*
+	* Check if the heap is empty
+	* @return true if empty, else false
+	*/
+	bool isEmpty() const;
+
+private:
+
+	// Pointer to a node, the low bit marks the node it points to deleted
+	using Link = std::uintptr_t;
+
+	// A node of the skiplist, followed in memory by its height links
+	struct alignas(std::atomic<Link>) Node {
+
+		alignas(T) unsigned char storage[sizeof(T)];
+		int height;
+		std::atomic<bool> inserting;
+
+		T& item() { return *reinterpret_cast<T*>(this->storage); }
+		std::atomic<Link>* next() { return reinterpret_cast<std::atomic<Link>*>(this + 1); }
+	};
+
+	// Sentinels before the first & after the last node
+	Node* head;
+	Node* tail;
+
+	// Comparator ordering the heap, comp(a, b) is true if b has priority
+	Compare comp;
+
+	// Constants for levels of the skiplist & deleted nodes left linked
+	static const int LEVELS = 32, BOUND_OFFSET = 32;
+
+	// Constant for empty heap, thrown by peek
+	static const int EMPTY = 0;
+
+	// Constant for the deleted mark of a link
+	static const Link MARK = 1;
+
+	/*
+	* Static method
+	* Allocates a node with the given height, its links null
+	* @param height The number of levels the node is linked in
+	* @return the node, without an item
+	*/
+	static Node* allocate(int height);
+
+	/*
+	* Static method
+	* Destroys the item of a node & deallocates it, given to Epoch::retire
+	* @param node The node
+	*/
+	static void destroy(void* node);
+
+	/*
+	* Static method
+	* Gets a random height, 1 with probability 1/2, 2 with 1/4 & so on
+	* @return the height
+	*/
+	static int randomHeight();
+
+	/*
+	* Static method
+	* Gets the node a link points to
+	* @param link The link
+	* @return the node
+	*/
+	static Node* node(Link link);
+
+	/*
+	* Static method
+	* Checks if a link marks the node it points to deleted
+	* @param link The link
+	* @return true if marked, else false
+	*/
+	static bool marked(Link link);
+
+	/*
+	* Links an allocated node with an item into the skiplist
+	* @param node The node to insert
+	*/
+	void insert(Node* node);
+
+	/*
+	* Marks the first live node deleted and unlinks the deleted prefix once long enough,
+	* the caller must hold an Epoch::Guard
+	* @return the deleted node, nullptr if the heap was empty
+	*/
+	Node* take();
+
+	/*
+	* Finds the nodes before & after where item belongs in every level
+	* @param item The item to find the position of
+	* @param preds Set to the node before the position in each level
+	* @param succs Set to the node after the position in each level
+	* @return the last deleted node passed in the bottom level, nullptr if none
+	*/
+	Node* locate(const T& item, Node* preds[], Node* succs[]) const;
+
+	/*
+	* Gets the first node not deleted
+	* @return the first live node, tail if empty
+	*/
+	Node* first() const;
+
+	/*
+	* Moves the upper links of head past deleted nodes
+	*/
+	void restructure();
+
+};
+#include "lockfreeheap.cpp"
+#endif // LOCKFREEHEAP_H
@@ -0,0 +1,26 @@
+/*
+* mappedheap.h
+*
+* Specifications for MappedHeap class
+*
+* @author Juan Arias
+*
+*/
+
+#ifndef MAPPEDHEAP_H
+#define MAPPEDHEAP_H
+
+#include <functional>
+#include "basicheap.h"
+#include "mappedstorage.h"
+
+/*
+* A MappedHeap is an implementation of the Heap interface stored in a memory
+* mapped file, constructed with std::in_place & the path of the file. The heap
+* the file holds is reopened as it was closed, without being formed again,
+* so it must be reopened with the same Compare & D it was written with.
+*/
+template <class T, class Compare = std::less<T>, int D = 2>
+using MappedHeap = BasicHeap<T, Compare, MappedStorage<T>, D>;
+
+#endif // MAPPEDHEAP_H
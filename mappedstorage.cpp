@@ -0,0 +1,463 @@
+#include "mappedstorage.h"
+/*
+* mappedstorage.cpp
+*
+* Implementations for MappedStorage class
+*
+* @author Juan Arias
+*
+*/
+
+#include <cerrno>
+#include <climits>
+#include <stdexcept>
+#include <system_error>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+  //**************// //**************// //**************//
+ //*  PUBLIC:   *// //*  PUBLIC:   *// //*  PUBLIC:   *//
+//**************// //**************// //**************//
+
+/*
+* Destroys storage, flushing & closing the file
+*/
+template <class T>
+MappedStorage<T>::~MappedStorage() {
+
+	if (this->file >= 0) {
+
+		// Items reach the disk before the header marks the file closed
+		if (this->flush()) {
+
+			this->header()->closed = 1;
+			msync(this->base, MappedStorage::DATA, MS_SYNC);
+		}
+
+		this->close();
+	}
+}
+
+/*
+* Assignment operator, copies the items into this storage's file
+* @param other The other heap to copy
+* @return this heap by reference
+*/
+template <class T>
+MappedStorage<T>& MappedStorage<T>::operator=(const MappedStorage<T>& other) {
+
+	this->Heap<T>::operator=(other);
+
+	return (*this);
+}
+
+/*
+* Move assignment operator, copies the items into this storage's file
+* @param other The other heap to move from, left empty
+* @return this heap by reference
+*/
+template <class T>
+MappedStorage<T>& MappedStorage<T>::operator=(MappedStorage<T>&& other) {
+
+	this->MappedStorage::operator=(static_cast<Heap<T>&&>(other));
+
+	return (*this);
+}
+
+/*
+* Move assignment operator overload, copies the items into this storage's file
+* @param other The other heap to move from, left empty
+* @return this heap by reference
+*/
+template <class T>
+Heap<T>& MappedStorage<T>::operator=(Heap<T>&& other) {
+
+	if (this != &other) {
+
+		this->Heap<T>::operator=(static_cast<const Heap<T>&>(other));
+
+		other.clear();
+	}
+
+	return (*this);
+}
+
+/*
+* Clear the heap, keeping the capacity of the file
+*/
+template <class T>
+void MappedStorage<T>::clear() {
+
+	if (this->file >= 0) {
+
+		this->itemCount = Heap<T>::EMPTY;
+
+	} else {
+
+		this->Heap<T>::clear();
+	}
+}
+
+/*
+* Flushes the items & header to disk, so the file reopens as it is now
+* even if the process exits without closing it
+*/
+template <class T>
+void MappedStorage<T>::checkpoint() {
+
+	if (this->file < 0) {
+
+		return;
+	}
+
+	if (!this->flush()) {
+
+		this->fail("msync");
+	}
+}
+
+  //***************// //***************// //***************//
+ //*  PROTECTED: *// //*  PROTECTED: *// //*  PROTECTED: *//
+//***************// //***************// //***************//
+
+/*
+* Constructs heap stored in the given file, reopening the heap it holds
+* or creating the file if it does not exist. A file not closed & changed
+* since its last checkpoint is refused, unless recovering, which reopens
+* as many items as were checkpointed from the slots as they are now, so
+* items added or removed since may be lost or return
+* @param arity The number of children per node
+* @param path The path of the file
+* @param recover Whether to recover a file changed since its last checkpoint
+*/
+template <class T>
+MappedStorage<T>::MappedStorage(int arity, const std::string& path, bool recover)
+	:Heap<T>(arity), file(-1), path(path), base(nullptr), length(0), recovered(false) {
+
+	this->file = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+
+	if (this->file < 0) {
+
+		this->fail("open");
+	}
+
+	try {
+
+		struct stat info;
+
+		if (fstat(this->file, &info) != 0) {
+
+			this->fail("fstat");
+		}
+
+		if (info.st_size == 0) {
+
+			std::size_t length = MappedStorage::lengthFor(Heap<T>::EMPTY, this->pad);
+
+			if (ftruncate(this->file, static_cast<off_t>(length)) != 0) {
+
+				this->fail("ftruncate");
+			}
+
+			this->map(length);
+
+			Header* header = this->header();
+
+			header->magic = MappedStorage::MAGIC;
+			header->version = MappedStorage::VERSION;
+			header->size = sizeof(T);
+			header->arity = static_cast<std::uint32_t>(arity);
+			header->count = Heap<T>::EMPTY;
+			header->capacity = Heap<T>::EMPTY;
+			header->checksum = this->checksum();
+
+		} else if (static_cast<std::size_t>(info.st_size) < MappedStorage::DATA) {
+
+			throw std::runtime_error(path + " is not a heap file");
+
+		} else {
+
+			this->map(static_cast<std::size_t>(info.st_size));
+			this->validate();
+
+			const Header* header = this->header();
+
+			if (!header->closed && header->checksum != this->checksum()) {
+
+				if (!recover) {
+
+					throw std::runtime_error(path + " was not closed & changed since its last checkpoint");
+				}
+
+				this->recovered = true;
+			}
+		}
+
+		this->itemCount = static_cast<int>(this->header()->count);
+		this->MAX = static_cast<int>(this->header()->capacity);
+
+		// Marked open until closed, so a crash is caught when reopened
+		this->header()->closed = 0;
+
+		if (msync(this->base, MappedStorage::DATA, MS_SYNC) != 0) {
+
+			this->fail("msync");
+		}
+
+	} catch (...) {
+
+		this->itemCount = Heap<T>::EMPTY;
+		this->close();
+
+		throw;
+	}
+}
+
+/*
+* Move constructor, takes over the file or the items kept in memory
+* @param other The other heap to move from, left empty
+*/
+template <class T>
+MappedStorage<T>::MappedStorage(MappedStorage<T>&& other) noexcept
+	:Heap<T>(other.arity), file(other.file), path(std::move(other.path)),
+	 base(other.base), length(other.length), recovered(other.recovered) {
+
+	// Taken directly, Heap's move would copy a mapped array item by item
+	this->arr = other.arr;
+	this->itemCount = other.itemCount;
+	this->MAX = other.MAX;
+	this->growth = other.growth;
+	this->pad = other.pad;
+
+	other.arr = nullptr;
+	other.itemCount = Heap<T>::EMPTY;
+	other.MAX = Heap<T>::EMPTY;
+	other.file = -1;
+	other.base = nullptr;
+	other.length = 0;
+}
+
+/*
+* Resizes the file & its mapping to the given capacity
+* @param capacity The capacity of the new array
+*/
+template <class T>
+void MappedStorage<T>::reallocate(int capacity) {
+
+	if (this->file < 0) {
+
+		this->Heap<T>::reallocate(capacity);
+		return;
+	}
+
+	std::size_t length = MappedStorage::lengthFor(capacity, this->pad);
+
+	if (ftruncate(this->file, static_cast<off_t>(length)) != 0) {
+
+		this->fail("ftruncate");
+	}
+
+	this->map(length);
+
+	this->MAX = capacity;
+	this->header()->capacity = capacity;
+}
+
+/*
+* Whether the items in the array form a heap, false if recovered from a
+* file changed since its last checkpoint
+* @return true if in order, else false
+*/
+template <class T>
+bool MappedStorage<T>::isOrdered() const {
+
+	return !this->recovered;
+}
+
+/*
+* Whether the array was allocated by the allocator, false while mapped
+* @return true if owned, else false
+*/
+template <class T>
+bool MappedStorage<T>::ownsArray() const {
+
+	return this->file < 0;
+}
+
+  //**************// //**************// //**************//
+ //*  PRIVATE:  *// //*  PRIVATE:  *// //*  PRIVATE:  *//
+//**************// //**************// //**************//
+
+/*
+* Gets the header of the file
+* @return the header
+*/
+template <class T>
+typename MappedStorage<T>::Header* MappedStorage<T>::header() const {
+
+	return reinterpret_cast<Header*>(this->base);
+}
+
+/*
+* Maps the given length of the file, replacing any current mapping
+* @param length The length in bytes
+*/
+template <class T>
+void MappedStorage<T>::map(std::size_t length) {
+
+	void* mapped;
+
+#ifdef __linux__
+	if (this->base != nullptr) {
+
+		mapped = mremap(this->base, this->length, length, MREMAP_MAYMOVE);
+
+	} else {
+
+		mapped = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, this->file, 0);
+	}
+#else
+	if (this->base != nullptr) {
+
+		munmap(this->base, this->length);
+		this->base = nullptr;
+	}
+
+	mapped = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, this->file, 0);
+#endif
+
+	if (mapped == MAP_FAILED) {
+
+		this->fail("mmap");
+	}
+
+	this->base = static_cast<unsigned char*>(mapped);
+	this->length = length;
+
+	this->arr = reinterpret_cast<T*>(this->base + MappedStorage::DATA) + this->pad;
+}
+
+/*
+* Checks the header describes a heap of this type & arity
+*/
+template <class T>
+void MappedStorage<T>::validate() const {
+
+	const Header* header = this->header();
+
+	if (header->magic != MappedStorage::MAGIC) {
+
+		throw std::runtime_error(this->path + " is not a heap file");
+	}
+
+	if (header->version != MappedStorage::VERSION) {
+
+		throw std::runtime_error(this->path + " has unsupported version " + std::to_string(header->version));
+	}
+
+	if (header->size != sizeof(T) || header->arity != static_cast<std::uint32_t>(this->arity)) {
+
+		throw std::runtime_error(this->path + " holds items of another size or arity");
+	}
+
+	if (header->capacity < Heap<T>::EMPTY || header->capacity > INT_MAX
+	    || header->count < Heap<T>::EMPTY || header->count > header->capacity
+	    || MappedStorage::lengthFor(header->capacity, this->pad) > this->length) {
+
+		throw std::runtime_error(this->path + " is truncated");
+	}
+}
+
+/*
+* Writes the item count & checksum to the header and flushes the file to disk
+* @return true if flushed, else false
+*/
+template <class T>
+bool MappedStorage<T>::flush() {
+
+	Header* header = this->header();
+
+	header->count = this->itemCount;
+	header->capacity = this->MAX;
+	header->checksum = this->checksum();
+
+	return msync(this->base, this->length, MS_SYNC) == 0;
+}
+
+/*
+* Unmaps & closes the file
+*/
+template <class T>
+void MappedStorage<T>::close() {
+
+	if (this->base != nullptr) {
+
+		munmap(this->base, this->length);
+	}
+
+	::close(this->file);
+
+	this->file = -1;
+	this->base = nullptr;
+	this->length = 0;
+
+	// The array was the mapping, there is nothing left for Heap to deallocate
+	this->arr = nullptr;
+	this->itemCount = Heap<T>::EMPTY;
+	this->MAX = Heap<T>::EMPTY;
+}
+
+/*
+* Gets the checksum of the item count & items
+* @return the checksum
+*/
+template <class T>
+std::uint64_t MappedStorage<T>::checksum() const {
+
+	const Header* header = this->header();
+
+	// FNV-1a
+	std::uint64_t hash = 0xcbf29ce484222325;
+
+	const unsigned char* count = reinterpret_cast<const unsigned char*>(&header->count);
+
+	for (std::size_t i(0); i < sizeof(header->count); ++i) {
+
+		hash = (hash ^ count[i]) * 0x100000001b3;
+	}
+
+	const unsigned char* items = reinterpret_cast<const unsigned char*>(this->arr);
+	std::size_t bytes = sizeof(T) * static_cast<std::size_t>(header->count);
+
+	for (std::size_t i(0); i < bytes; ++i) {
+
+		hash = (hash ^ items[i]) * 0x100000001b3;
+	}
+
+	return hash;
+}
+
+/*
+* Throws the error of the last failed system call
+* @param call The name of the call
+*/
+template <class T>
+void MappedStorage<T>::fail(const char* call) const {
+
+	throw std::system_error(errno, std::generic_category(), std::string(call) + " " + this->path);
+}
+
+/*
+* Static method
+* Gets the length of a file holding an array of the given capacity
+* @param capacity The capacity of the array
+* @param pad The number of unused slots before the array
+* @return the length in bytes
+*/
+template <class T>
+std::size_t MappedStorage<T>::lengthFor(long long capacity, int pad) {
+
+	return MappedStorage::DATA + sizeof(T) * static_cast<std::size_t>(capacity + pad);
+}
@@ -0,0 +1,194 @@
+/*
+* mappedstorage.h
+*
+* Specifications for MappedStorage class
+*
+* @author Juan Arias
+*
+*/
+
+#ifndef MAPPEDSTORAGE_H
+#define MAPPEDSTORAGE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include "heap.h"
+
+/*
+* MappedStorage is Storage for a BasicHeap that keeps the array in a memory
+* mapped file after a one page header, so a heap closed cleanly reopens in
+* O(1) and the OS pages its items in as they are touched. checkpoint flushes
+* the file to disk; a file not closed since is verified against the checksum
+* of its last checkpoint when reopened, & refused if changed unless reopened
+* to recover. Items are stored as raw bytes, so must be trivially copyable.
+* A MappedStorage moved from keeps items in memory.
+*/
+template <class T>
+class MappedStorage : public Heap<T> {
+
+	static_assert(std::is_trivially_copyable<T>::value, "MappedStorage stores items as raw bytes");
+
+public:
+
+	/*
+	* Destroys storage, flushing & closing the file
+	*/
+	virtual ~MappedStorage();
+
+	/*
+	* Assignment operator, copies the items into this storage's file
+	* @param other The other heap to copy
+	* @return this heap by reference
+	*/
+	virtual MappedStorage& operator=(const MappedStorage& other);
+
+	/*
+	* Move assignment operator, copies the items into this storage's file
+	* @param other The other heap to move from, left empty
+	* @return this heap by reference
+	*/
+	virtual MappedStorage& operator=(MappedStorage&& other);
+
+	/*
+	* Move assignment operator overload, copies the items into this storage's file
+	* @param other The other heap to move from, left empty
+	* @return this heap by reference
+	*/
+	Heap<T>& operator=(Heap<T>&& other) override;
+
+	/*
+	* Clear the heap, keeping the capacity of the file
+	*/
+	void clear() override;
+
+	/*
+	* Flushes the items & header to disk, so the file reopens as it is now
+	* even if the process exits without closing it
+	*/
+	void checkpoint();
+
+protected:
+
+	/*
+	* Constructs heap stored in the given file, reopening the heap it holds
+	* or creating the file if it does not exist. A file not closed & changed
+	* since its last checkpoint is refused, unless recovering, which reopens
+	* as many items as were checkpointed from the slots as they are now, so
+	* items added or removed since may be lost or return
+	* @param arity The number of children per node
+	* @param path The path of the file
+	* @param recover Whether to recover a file changed since its last checkpoint
+	*/
+	MappedStorage(int arity, const std::string& path, bool recover = false);
+
+	/*
+	* Move constructor, takes over the file or the items kept in memory
+	* @param other The other heap to move from, left empty
+	*/
+	MappedStorage(MappedStorage&& other) noexcept;
+
+	/*
+	* Resizes the file & its mapping to the given capacity
+	* @param capacity The capacity of the new array
+	*/
+	void reallocate(int capacity) override;
+
+	/*
+	* Whether the items in the array form a heap, false if recovered from a
+	* file changed since its last checkpoint
+	* @return true if in order, else false
+	*/
+	bool isOrdered() const override;
+
+	/*
+	* Whether the array was allocated by the allocator, false while mapped
+	* @return true if owned, else false
+	*/
+	bool ownsArray() const override;
+
+private:
+
+	// Layout of the first page of the file
+	struct Header {
+
+		std::uint64_t magic;
+		std::uint32_t version, size, arity, closed;
+		std::int64_t count, capacity;
+		std::uint64_t checksum;
+	};
+
+	// File descriptor, -1 if not stored in a file
+	int file;
+
+	// Path of the file
+	std::string path;
+
+	// Mapping of the file & its length in bytes
+	unsigned char* base;
+	std::size_t length;
+
+	// Whether the items were recovered, so may not form a heap
+	bool recovered;
+
+	// Constants identifying the file format
+	static const std::uint64_t MAGIC = 0x3150414d50414548;
+	static const std::uint32_t VERSION = 1;
+
+	// Constant for bytes before the array, one page holding the header
+	static const std::size_t DATA = 4096;
+
+	/*
+	* Gets the header of the file
+	* @return the header
+	*/
+	Header* header() const;
+
+	/*
+	* Maps the given length of the file, replacing any current mapping
+	* @param length The length in bytes
+	*/
+	void map(std::size_t length);
+
+	/*
+	* Checks the header describes a heap of this type & arity
+	*/
+	void validate() const;
+
+	/*
+	* Writes the item count & checksum to the header and flushes the file to disk
+	* @return true if flushed, else false
+	*/
+	bool flush();
+
+	/*
+	* Unmaps & closes the file
+	*/
+	void close();
+
+	/*
+	* Gets the checksum of the item count & items
+	* @return the checksum
+	*/
+	std::uint64_t checksum() const;
+
+	/*
+	* Throws the error of the last failed system call
+	* @param call The name of the call
+	*/
+	void fail(const char* call) const;
+
+	/*
+	* Static method
+	* Gets the length of a file holding an array of the given capacity
+	* @param capacity The capacity of the array
+	* @param pad The number of unused slots before the array
+	* @return the length in bytes
+	*/
+	static std::size_t lengthFor(long long capacity, int pad);
+
+};
+
+#include "mappedstorage.cpp"
+#endif // MAPPEDSTORAGE_H
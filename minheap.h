@@ -0,0 +1,23 @@
+/*
+* minheap.h
+* 
+* Specifications for MinHeap class
+*
+* @author Juan Arias
+*
+*/
+
+#ifndef MINHEAP_H
+#define MINHEAP_H
+
+#include <functional>
+#include "basicheap.h"
+
+/*
+* A MinHeap is an implementation of the Heap interface that prioritizes
+* the minimum value.
+*/
+template <class T>
+using MinHeap = BasicHeap<T, std::greater<T>>;
+
+#endif // MINHEAP_H
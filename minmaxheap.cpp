@@ -0,0 +1,567 @@
+#include "minmaxheap.h"
+/*
+* minmaxheap.cpp
+*
+* Implementations for MinMaxHeap class
+*
+* @author Juan Arias
+*
+*/
+
+#include <algorithm>
+
+  //**************// //**************// //**************//
+ //*  PUBLIC:   *// //*  PUBLIC:   *// //*  PUBLIC:   *//
+//**************// //**************// //**************//
+
+/*
+* Constructs empty heap
+*/
+template <class T, class Compare>
+MinMaxHeap<T, Compare>::MinMaxHeap() :MinMaxHeap(Compare()) {}
+
+/*
+* Constructs empty heap ordered by given comparator
+* @param comp The comparator to order the heap by
+*/
+template <class T, class Compare>
+MinMaxHeap<T, Compare>::MinMaxHeap(const Compare& comp) :Heap<T>(Heap<T>::BINARY), comp(comp), bound(Heap<T>::EMPTY) {}
+
+/*
+* Constructs empty heap holding at most bound items, each add past the
+* bound evicting the least item, possibly the one added
+* @param bound The number of items to hold at most, unbounded if not positive
+* @param comp The comparator to order the heap by
+*/
+template <class T, class Compare>
+MinMaxHeap<T, Compare>::MinMaxHeap(int bound, const Compare& comp)
+	:Heap<T>(Heap<T>::BINARY), comp(comp), bound(std::max(bound, int(Heap<T>::EMPTY))) {
+
+	if (this->bound > Heap<T>::EMPTY) {
+
+		this->reserve(this->bound);
+	}
+}
+
+/*
+* Constructs heap from given array
+* @param arr The array to construct heap from
+* @param size The size of arr
+* @param comp The comparator to order the heap by
+*/
+template <class T, class Compare>
+MinMaxHeap<T, Compare>::MinMaxHeap(const T arr[], int size, const Compare& comp)
+	:Heap<T>(arr, size, Heap<T>::BINARY), comp(comp), bound(Heap<T>::EMPTY) {
+
+	this->heapify();
+}
+
+/*
+* Copy constructor
+* @param other The other heap to copy
+*/
+template <class T, class Compare>
+MinMaxHeap<T, Compare>::MinMaxHeap(const MinMaxHeap& other)
+	:Heap<T>(Heap<T>::BINARY), comp(other.comp), bound(other.bound) {
+
+	this->Heap<T>::operator=(other);
+}
+
+/*
+* Move constructor
+* @param other The other heap to move from, left empty
+*/
+template <class T, class Compare>
+MinMaxHeap<T, Compare>::MinMaxHeap(MinMaxHeap&& other) noexcept
+	:Heap<T>(std::move(other)), comp(std::move(other.comp)), bound(other.bound) {}
+
+/*
+* Destroys heap and deallocates all dynamic memory
+*/
+template <class T, class Compare>
+MinMaxHeap<T, Compare>::~MinMaxHeap() {}
+
+/*
+* Assignment operator overload, the items are formed into a min-max heap
+* & the least evicted past the bound
+* @param other The other heap to copy
+* @return this heap by reference
+*/
+template <class T, class Compare>
+Heap<T>& MinMaxHeap<T, Compare>::operator=(const Heap<T>& other) {
+
+	this->Heap<T>::operator=(other);
+
+	this->heapify();
+	this->evict();
+
+	return (*this);
+}
+
+/*
+* Assignment operator
+* @param other The other heap to copy
+* @return this heap by reference
+*/
+template <class T, class Compare>
+MinMaxHeap<T, Compare>& MinMaxHeap<T, Compare>::operator=(const MinMaxHeap& other) {
+
+	if (this != &other) {
+
+		this->Heap<T>::operator=(other);
+
+		this->comp = other.comp;
+		this->bound = other.bound;
+	}
+
+	return (*this);
+}
+
+/*
+* Move assignment operator overload, the items are formed into a min-max
+* heap & the least evicted past the bound
+* @param other The other heap to move from, left empty
+* @return this heap by reference
+*/
+template <class T, class Compare>
+Heap<T>& MinMaxHeap<T, Compare>::operator=(Heap<T>&& other) {
+
+	this->Heap<T>::operator=(std::move(other));
+
+	this->heapify();
+	this->evict();
+
+	return (*this);
+}
+
+/*
+* Move assignment operator
+* @param other The other heap to move from, left empty
+* @return this heap by reference
+*/
+template <class T, class Compare>
+MinMaxHeap<T, Compare>& MinMaxHeap<T, Compare>::operator=(MinMaxHeap&& other) noexcept {
+
+	if (this != &other) {
+
+		this->Heap<T>::operator=(std::move(other));
+
+		this->comp = std::move(other.comp);
+		this->bound = other.bound;
+	}
+
+	return (*this);
+}
+
+/*
+* Add item to the heap, evicting the least item if past the bound
+* @param item The item to add to the heap
+*/
+template <class T, class Compare>
+void MinMaxHeap<T, Compare>::add(const T& item) {
+
+	this->insert(item);
+}
+
+/*
+* Add item to the heap by moving it, evicting the least item if past the bound
+* @param item The item to move into the heap
+*/
+template <class T, class Compare>
+void MinMaxHeap<T, Compare>::add(T&& item) {
+
+	this->insert(std::move(item));
+}
+
+/*
+* Remove the greatest item in the heap
+*/
+template <class T, class Compare>
+void MinMaxHeap<T, Compare>::remove() {
+
+	HEAP_SCOPE(this->stats);
+
+	if (this->itemCount > Heap<T>::EMPTY) {
+
+		this->removeNode(Heap<T>::ROOT);
+	}
+}
+
+/*
+* Remove the least item in the heap
+*/
+template <class T, class Compare>
+void MinMaxHeap<T, Compare>::removeMin() {
+
+	HEAP_SCOPE(this->stats);
+
+	if (this->itemCount > Heap<T>::EMPTY) {
+
+		this->removeNode(this->minNode());
+	}
+}
+
+/*
+* Remove the greatest item in the heap and return it
+* @return the greatest item, moved out of the heap
+*/
+template <class T, class Compare>
+T MinMaxHeap<T, Compare>::popMax() {
+
+	HEAP_SCOPE(this->stats);
+
+	T top = std::move(this->peek());
+
+	this->removeNode(Heap<T>::ROOT);
+
+	return top;
+}
+
+/*
+* Remove the least item in the heap and return it
+* @return the least item, moved out of the heap
+*/
+template <class T, class Compare>
+T MinMaxHeap<T, Compare>::popMin() {
+
+	HEAP_SCOPE(this->stats);
+
+	if (this->itemCount == Heap<T>::EMPTY) {
+
+		throw Heap<T>::EMPTY;
+	}
+
+	Node least = this->minNode();
+	T bottom = std::move(this->arr[least]);
+
+	this->removeNode(least);
+
+	return bottom;
+}
+
+/*
+* Get the greatest item in the heap, the peek item
+* @return the greatest item in the heap
+*/
+template <class T, class Compare>
+const T& MinMaxHeap<T, Compare>::peekMax() const {
+
+	return this->peek();
+}
+
+/*
+* Get the least item in the heap
+* @return the least item in the heap
+*/
+template <class T, class Compare>
+const T& MinMaxHeap<T, Compare>::peekMin() const {
+
+	if (this->itemCount == Heap<T>::EMPTY) {
+
+		throw Heap<T>::EMPTY;
+	}
+
+	return this->arr[this->minNode()];
+}
+
+/*
+* Check if item is in the heap
+* @param item The item to search for
+* @return true if found, else false
+*/
+template <class T, class Compare>
+bool MinMaxHeap<T, Compare>::contains(const T& item) {
+
+	bool found(false);
+
+	for (Node curr(Heap<T>::ROOT); curr < this->itemCount && !found; ++curr) {
+
+		found = (this->arr[curr] == item);
+	}
+
+	return found;
+}
+
+/*
+* Get the number of items the heap holds at most
+* @return the bound, 0 if unbounded
+*/
+template <class T, class Compare>
+int MinMaxHeap<T, Compare>::getBound() const {
+
+	return this->bound;
+}
+
+  //**************// //**************// //**************//
+ //*  PRIVATE:  *// //*  PRIVATE:  *// //*  PRIVATE:  *//
+//**************// //**************// //**************//
+
+/*
+* Adds item to the heap, evicting the least item if past the bound
+* @param item The item to add, forwarded into the heap
+*/
+template <class T, class Compare>
+template <class Item>
+void MinMaxHeap<T, Compare>::insert(Item&& item) {
+
+	HEAP_SCOPE(this->stats);
+
+	if (this->bound > Heap<T>::EMPTY && this->itemCount == this->bound) {
+
+		// An item not greater than the least would be evicted at once
+		if (!this->comp(this->peekMin(), item)) {
+
+			return;
+		}
+
+		this->removeMin();
+	}
+
+	this->append(std::forward<Item>(item));
+
+	this->bubbleUp();
+}
+
+/*
+* Evicts the least items until the heap is within its bound
+*/
+template <class T, class Compare>
+void MinMaxHeap<T, Compare>::evict() {
+
+	while (this->bound > Heap<T>::EMPTY && this->itemCount > this->bound) {
+
+		this->removeMin();
+	}
+}
+
+/*
+* Gets the node of the least item, the heap must not be empty
+* @return the node of the least item
+*/
+template <class T, class Compare>
+Node MinMaxHeap<T, Compare>::minNode() const {
+
+	Node least = Heap<T>::left(Heap<T>::ROOT);
+
+	if (least >= this->itemCount) {
+
+		return Heap<T>::ROOT;
+	}
+
+	if (least + 1 < this->itemCount && this->comp(this->arr[least + 1], this->arr[least])) {
+
+		++least;
+	}
+
+	return least;
+}
+
+/*
+* Moves the last item into the given node & trickles it down,
+* the heap must not be empty
+* @param curr The node to remove
+*/
+template <class T, class Compare>
+void MinMaxHeap<T, Compare>::removeNode(Node curr) {
+
+	HeapStats::remove();
+
+	if (--this->itemCount > curr) {
+
+		this->arr[curr] = std::move(this->arr[this->itemCount]);
+	}
+
+	this->arr[this->itemCount].~T();
+
+	if (curr < this->itemCount) {
+
+		this->rebuild(curr);
+	}
+}
+
+/*
+* Forms min-max heap from every item in the array, bottom-up
+*/
+template <class T, class Compare>
+void MinMaxHeap<T, Compare>::heapify() {
+
+	HEAP_SCOPE(this->stats);
+
+	if (this->itemCount > 1) {
+
+		for (Node curr = Heap<T>::parent(this->itemCount - 1); curr >= Heap<T>::ROOT; --curr) {
+
+			this->rebuild(curr);
+		}
+	}
+}
+
+/*
+* Bubbles the last node up the heap until in correct position
+*/
+template <class T, class Compare>
+void MinMaxHeap<T, Compare>::bubbleUp() {
+
+	Node curr = this->itemCount - 1;
+
+	if (curr == Heap<T>::ROOT) {
+
+		HeapStats::sift(0);
+		return;
+	}
+
+	Node parent = Heap<T>::parent(curr);
+	bool max = MinMaxHeap::isMaxLevel(curr);
+
+	HeapStats::compare();
+
+	// The parent is on the other kind of level, so an item beyond it belongs on the parent's levels
+	if (this->above(this->arr[curr], this->arr[parent], !max)) {
+
+		this->swap(curr, parent);
+
+		HeapStats::move(3);
+		HeapStats::sift(this->bubbleUp(parent, !max) + 1);
+
+	} else {
+
+		HeapStats::sift(this->bubbleUp(curr, max));
+	}
+}
+
+/*
+* Bubbles node up the levels of its kind until in correct position
+* @param curr The current node in the heap
+* @param max True if curr is on a max level, else false
+* @return the number of levels the node moved
+*/
+template <class T, class Compare>
+int MinMaxHeap<T, Compare>::bubbleUp(Node curr, bool max) {
+
+	T item = std::move(this->arr[curr]);
+	int depth(0), comparisons(0);
+
+	while (Heap<T>::parent(curr) > Heap<T>::ROOT) {
+
+		Node grandparent = Heap<T>::parent(Heap<T>::parent(curr));
+
+		++comparisons;
+
+		if (!this->above(item, this->arr[grandparent], max)) {
+
+			break;
+		}
+
+		this->arr[curr] = std::move(this->arr[grandparent]);
+		curr = grandparent;
+		depth += 2;
+	}
+
+	this->arr[curr] = std::move(item);
+
+	HeapStats::compare(comparisons);
+	HeapStats::move(depth / 2 + 2);
+
+	return depth;
+}
+
+/*
+* Trickles node down the heap until in correct position
+* @param curr The current node in the heap
+*/
+template <class T, class Compare>
+void MinMaxHeap<T, Compare>::rebuild(Node curr) {
+
+	bool max = MinMaxHeap::isMaxLevel(curr);
+	int depth(0), comparisons(0), swaps(0);
+
+	while (!Heap<T>::isLeaf(curr, this->itemCount)) {
+
+		// The item belonging highest among the children & grandchildren
+		Node child = Heap<T>::left(curr);
+		Node grandchild = Heap<T>::left(child);
+		Node best = child;
+		Node last = std::min(grandchild + 4, this->itemCount);
+
+		// Picking the best of the other children & grandchildren & comparing the item with it
+		comparisons += std::min(child + 2, this->itemCount) - child + std::max(last - grandchild, 0);
+
+		if (child + 1 < this->itemCount && this->above(this->arr[child + 1], this->arr[best], max)) {
+
+			best = child + 1;
+		}
+
+		for (Node next = grandchild; next < last; ++next) {
+
+			if (this->above(this->arr[next], this->arr[best], max)) {
+
+				best = next;
+			}
+		}
+
+		if (!this->above(this->arr[best], this->arr[curr], max)) {
+
+			break;
+		}
+
+		this->swap(curr, best);
+		++swaps;
+
+		if (best < grandchild) {
+
+			++depth;
+			break;
+		}
+
+		depth += 2;
+
+		// The item moved down may not belong below its new parent, on the other kind of level
+		Node parent = Heap<T>::parent(best);
+
+		++comparisons;
+
+		if (this->above(this->arr[best], this->arr[parent], !max)) {
+
+			this->swap(best, parent);
+			++swaps;
+		}
+
+		curr = best;
+	}
+
+	HeapStats::compare(comparisons);
+	HeapStats::move(3 * swaps);
+	HeapStats::sift(depth);
+}
+
+/*
+* Checks if the first item belongs above the second on a level of the given kind
+* @param item1 The first item
+* @param item2 The second item
+* @param max True for a max level, else false
+* @return true if item1 belongs above item2, else false
+*/
+template <class T, class Compare>
+bool MinMaxHeap<T, Compare>::above(const T& item1, const T& item2, bool max) const {
+
+	return max ? this->comp(item2, item1) : this->comp(item1, item2);
+}
+
+/*
+* Static method
+* Checks if the given node is on a max level, the root's level being one
+* @param curr The current node
+* @return true if on a max level, else false
+*/
+template <class T, class Compare>
+bool MinMaxHeap<T, Compare>::isMaxLevel(Node curr) {
+
+	int level(0);
+
+	for (Node node = curr + 1; node > 1; node >>= 1) {
+
+		++level;
+	}
+
+	return level % 2 == 0;
+}
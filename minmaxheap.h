@@ -0,0 +1,240 @@
+/*
+* minmaxheap.h
+*
+* Specifications for MinMaxHeap class
+*
+* @author Juan Arias
+*
+*/
+
+#ifndef MINMAXHEAP_H
+#define MINMAXHEAP_H
+
+#include <functional>
+#include <utility>
+#include "heap.h"
+
+/*
+* A MinMaxHeap is a double-ended implementation of the Heap interface, laid
+* out as in Atkinson et al. with levels alternating between max & min: each
+* node on a max level compares greatest of its subtree by Compare & each node
+* on a min level least. The greatest item is the root & the least one of its
+* children, so both ends are peeked in O(1) & popped in O(log n). A bounded
+* heap evicts its least item when an add overflows it.
+*/
+template <class T, class Compare = std::less<T>>
+class MinMaxHeap : public Heap<T> {
+
+public:
+
+	/*
+	* Constructs empty heap
+	*/
+	MinMaxHeap();
+
+	/*
+	* Constructs empty heap ordered by given comparator
+	* @param comp The comparator to order the heap by
+	*/
+	explicit MinMaxHeap(const Compare& comp);
+
+	/*
+	* Constructs empty heap holding at most bound items, each add past the
+	* bound evicting the least item, possibly the one added
+	* @param bound The number of items to hold at most, unbounded if not positive
+	* @param comp The comparator to order the heap by
+	*/
+	explicit MinMaxHeap(int bound, const Compare& comp = Compare());
+
+	/*
+	* Constructs heap from given array
+	* @param arr The array to construct heap from
+	* @param size The size of arr
+	* @param comp The comparator to order the heap by
+	*/
+	MinMaxHeap(const T arr[], int size, const Compare& comp = Compare());
+
+	/*
+	* Copy constructor
+	* @param other The other heap to copy
+	*/
+	MinMaxHeap(const MinMaxHeap& other);
+
+	/*
+	* Move constructor
+	* @param other The other heap to move from, left empty
+	*/
+	MinMaxHeap(MinMaxHeap&& other) noexcept;
+
+	/*
+	* Destroys heap and deallocates all dynamic memory
+	*/
+	virtual ~MinMaxHeap();
+
+	/*
+	* Assignment operator overload, the items are formed into a min-max heap
+	* & the least evicted past the bound
+	* @param other The other heap to copy
+	* @return this heap by reference
+	*/
+	Heap<T>& operator=(const Heap<T>& other) override;
+
+	/*
+	* Assignment operator
+	* @param other The other heap to copy
+	* @return this heap by reference
+	*/
+	MinMaxHeap& operator=(const MinMaxHeap& other);
+
+	/*
+	* Move assignment operator overload, the items are formed into a min-max
+	* heap & the least evicted past the bound
+	* @param other The other heap to move from, left empty
+	* @return this heap by reference
+	*/
+	Heap<T>& operator=(Heap<T>&& other) override;
+
+	/*
+	* Move assignment operator
+	* @param other The other heap to move from, left empty
+	* @return this heap by reference
+	*/
+	MinMaxHeap& operator=(MinMaxHeap&& other) noexcept;
+
+	/*
+	* Add item to the heap, evicting the least item if past the bound
+	* @param item The item to add to the heap
+	*/
+	void add(const T& item) override;
+
+	/*
+	* Add item to the heap by moving it, evicting the least item if past the bound
+	* @param item The item to move into the heap
+	*/
+	void add(T&& item) override;
+
+	/*
+	* Remove the greatest item in the heap
+	*/
+	void remove() override;
+
+	/*
+	* Remove the least item in the heap
+	*/
+	void removeMin();
+
+	/*
+	* Remove the greatest item in the heap and return it
+	* @return the greatest item, moved out of the heap
+	*/
+	T popMax();
+
+	/*
+	* Remove the least item in the heap and return it
+	* @return the least item, moved out of the heap
+	*/
+	T popMin();
+
+	/*
+	* Get the greatest item in the heap, the peek item
+	* @return the greatest item in the heap
+	*/
+	const T& peekMax() const;
+
+	/*
+	* Get the least item in the heap
+	* @return the least item in the heap
+	*/
+	const T& peekMin() const;
+
+	/*
+	* Check if item is in the heap
+	* @param item The item to search for
+	* @return true if found, else false
+	*/
+	bool contains(const T& item) override;
+
+	/*
+	* Get the number of items the heap holds at most
+	* @return the bound, 0 if unbounded
+	*/
+	int getBound() const;
+
+private:
+
+	// Comparator ordering the heap, comp(a, b) is true if b is greater
+	Compare comp;
+
+	// Number of items the heap holds at most, 0 if unbounded
+	int bound;
+
+	/*
+	* Adds item to the heap, evicting the least item if past the bound
+	* @param item The item to add, forwarded into the heap
+	*/
+	template <class Item>
+	void insert(Item&& item);
+
+	/*
+	* Evicts the least items until the heap is within its bound
+	*/
+	void evict();
+
+	/*
+	* Gets the node of the least item, the heap must not be empty
+	* @return the node of the least item
+	*/
+	Node minNode() const;
+
+	/*
+	* Moves the last item into the given node & trickles it down,
+	* the heap must not be empty
+	* @param curr The node to remove
+	*/
+	void removeNode(Node curr);
+
+	/*
+	* Forms min-max heap from every item in the array, bottom-up
+	*/
+	void heapify();
+
+	/*
+	* Bubbles the last node up the heap until in correct position
+	*/
+	void bubbleUp();
+
+	/*
+	* Bubbles node up the levels of its kind until in correct position
+	* @param curr The current node in the heap
+	* @param max True if curr is on a max level, else false
+	* @return the number of levels the node moved
+	*/
+	int bubbleUp(Node curr, bool max);
+
+	/*
+	* Trickles node down the heap until in correct position
+	* @param curr The current node in the heap
+	*/
+	void rebuild(Node curr);
+
+	/*
+	* Checks if the first item belongs above the second on a level of the given kind
+	* @param item1 The first item
+	* @param item2 The second item
+	* @param max True for a max level, else false
+	* @return true if item1 belongs above item2, else false
+	*/
+	bool above(const T& item1, const T& item2, bool max) const;
+
+	/*
+	* Static method
+	* Checks if the given node is on a max level, the root's level being one
+	* @param curr The current node
+	* @return true if on a max level, else false
+	*/
+	static bool isMaxLevel(Node curr);
+
+};
+
+#include "minmaxheap.cpp"
+#endif // MINMAXHEAP_H
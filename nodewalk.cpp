@@ -0,0 +1,141 @@
+#include "nodewalk.h"
+/*
+* nodewalk.cpp
+*
+* Implementations for NodeWalk class
+*
+* @author Juan Arias
+*
+*/
+
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+/*
+* Static method
+* Copies the heap at the given root, deallocating the nodes copied if a
+* copy throws
+* @param root The root of the heap to copy
+* @return the root of the copy
+*/
+template <class T, class Node, Node* Node::*First, Node* Node::*Second>
+Node* NodeWalk<T, Node, First, Second>::copy(const Node* root) {
+
+	if (root == nullptr) {
+
+		return nullptr;
+	}
+
+	Node* copied = new Node{root->item, nullptr, nullptr};
+
+	try {
+
+		// Pairs of nodes whose links are yet to be copied
+		std::vector<std::pair<const Node*, Node*>> stack{ { root, copied } };
+
+		while (!stack.empty()) {
+
+			std::pair<const Node*, Node*> curr = stack.back();
+			stack.pop_back();
+
+			for (Node* Node::*link : { First, Second }) {
+
+				if (curr.first->*link != nullptr) {
+
+					// Linked before it is stacked, so destroy reaches it if stacking throws
+					curr.second->*link = new Node{(curr.first->*link)->item, nullptr, nullptr};
+					stack.emplace_back(curr.first->*link, curr.second->*link);
+				}
+			}
+		}
+
+	} catch (...) {
+
+		NodeWalk::destroy(copied);
+		throw;
+	}
+
+	return copied;
+}
+
+/*
+* Static method
+* Deallocates the heap at the given root
+* @param root The root of the heap to deallocate
+*/
+template <class T, class Node, Node* Node::*First, Node* Node::*Second>
+void NodeWalk<T, Node, First, Second>::destroy(Node* root) {
+
+	std::vector<Node*> stack;
+
+	if (root != nullptr) {
+
+		stack.push_back(root);
+	}
+
+	while (!stack.empty()) {
+
+		Node* curr = stack.back();
+		stack.pop_back();
+
+		for (Node* Node::*link : { First, Second }) {
+
+			if (curr->*link != nullptr) {
+
+				stack.push_back(curr->*link);
+			}
+		}
+
+		delete curr;
+	}
+}
+
+/*
+* Static method
+* Checks if item is in the heap at the given root, skipping the nodes
+* below one item has priority over
+* @param root The root of the heap to search
+* @param item The item to search for
+* @param comp The comparator ordering the heap
+* @param siblings Whether Second links to siblings rather than children,
+*                 so is followed even past items of lower priority
+* @return true if found, else false
+*/
+template <class T, class Node, Node* Node::*First, Node* Node::*Second>
+template <class Compare>
+bool NodeWalk<T, Node, First, Second>::contains(const Node* root, const T& item, const Compare& comp, bool siblings) {
+
+	std::vector<const Node*> stack;
+
+	if (root != nullptr) {
+
+		stack.push_back(root);
+	}
+
+	while (!stack.empty()) {
+
+		const Node* curr = stack.back();
+		stack.pop_back();
+
+		if (curr->item == item) {
+
+			return true;
+		}
+
+		// Children have lower priority, so are skipped once item has priority over their parent
+		bool descend = !comp(curr->item, item);
+
+		if (curr->*First != nullptr && descend) {
+
+			stack.push_back(curr->*First);
+		}
+
+		if (curr->*Second != nullptr && (descend || siblings)) {
+
+			stack.push_back(curr->*Second);
+		}
+	}
+
+	return false;
+}
@@ -0,0 +1,57 @@
+/*
+* nodewalk.h
+*
+* Specifications for NodeWalk class
+*
+* @author Juan Arias
+*
+*/
+
+#ifndef NODEWALK_H
+#define NODEWALK_H
+
+/*
+* NodeWalk holds the iterative walks shared by pointer-based heaps whose nodes
+* hold an item & two links, First & Second: copying, deallocating & searching
+* a heap with an explicit stack, so deep heaps never overflow the call stack.
+* Items behind First always have lower priority than their node.
+*/
+template <class T, class Node, Node* Node::*First, Node* Node::*Second>
+class NodeWalk {
+
+public:
+
+	/*
+	* Static method
+	* Copies the heap at the given root, deallocating the nodes copied if a
+	* copy throws
+	* @param root The root of the heap to copy
+	* @return the root of the copy
+	*/
+	static Node* copy(const Node* root);
+
+	/*
+	* Static method
+	* Deallocates the heap at the given root
+	* @param root The root of the heap to deallocate
+	*/
+	static void destroy(Node* root);
+
+	/*
+	* Static method
+	* Checks if item is in the heap at the given root, skipping the nodes
+	* below one item has priority over
+	* @param root The root of the heap to search
+	* @param item The item to search for
+	* @param comp The comparator ordering the heap
+	* @param siblings Whether Second links to siblings rather than children,
+	*                 so is followed even past items of lower priority
+	* @return true if found, else false
+	*/
+	template <class Compare>
+	static bool contains(const Node* root, const T& item, const Compare& comp, bool siblings);
+
+};
+
+#include "nodewalk.cpp"
+#endif // NODEWALK_H
@@ -0,0 +1,332 @@
+#include "pairingheap.h"
+/*
+* pairingheap.cpp
+*
+* Implementations for PairingHeap class
+*
+* @author Juan Arias
+*
+*/
+
+#include <utility>
+
+  //**************// //**************// //**************//
+ //*  PUBLIC:   *// //*  PUBLIC:   *// //*  PUBLIC:   *//
+//**************// //**************// //**************//
+
+/*
+* Constructs empty heap
+*/
+template <class T, class Compare>
+PairingHeap<T, Compare>::PairingHeap() :root(nullptr), itemCount(PairingHeap::EMPTY), comp() {}
+
+/*
+* Constructs empty heap ordered by given comparator
+* @param comp The comparator to order the heap by
+*/
+template <class T, class Compare>
+PairingHeap<T, Compare>::PairingHeap(const Compare& comp) :root(nullptr), itemCount(PairingHeap::EMPTY), comp(comp) {}
+
+/*
+* Constructs heap from given array
+* @param arr The array to construct heap from
+* @param size The size of arr
+* @param comp The comparator to order the heap by
+*/
+template <class T, class Compare>
+PairingHeap<T, Compare>::PairingHeap(const T arr[], int size, const Compare& comp) :PairingHeap(comp) {
+
+	for (int i(0); i < size; ++i) {
+
+		this->add(arr[i]);
+	}
+}
+
+/*
+* Copy constructor
+* @param other The other heap to copy
+*/
+template <class T, class Compare>
+PairingHeap<T, Compare>::PairingHeap(const PairingHeap& other)
+	:root(Walk::copy(other.root)), itemCount(other.itemCount), comp(other.comp) {}
+
+/*
+* Move constructor
+* @param other The other heap to move from, left empty
+*/
+template <class T, class Compare>
+PairingHeap<T, Compare>::PairingHeap(PairingHeap&& other) noexcept
+	:root(other.root), itemCount(other.itemCount), comp(std::move(other.comp)) {
+
+	other.root = nullptr;
+	other.itemCount = PairingHeap::EMPTY;
+}
+
+/*
+* Destroys heap and deallocates all dynamic memory
+*/
+template <class T, class Compare>
+PairingHeap<T, Compare>::~PairingHeap() {
+
+	Walk::destroy(this->root);
+}
+
+/*
+* Assignment operator
+* @param other The other heap to copy
+* @return this heap by reference
+*/
+template <class T, class Compare>
+PairingHeap<T, Compare>& PairingHeap<T, Compare>::operator=(const PairingHeap& other) {
+
+	if (this != &other) {
+
+		Node* copied = Walk::copy(other.root);
+
+		Walk::destroy(this->root);
+
+		this->root = copied;
+		this->itemCount = other.itemCount;
+		this->comp = other.comp;
+	}
+
+	return (*this);
+}
+
+/*
+* Move assignment operator
+* @param other The other heap to move from, left empty
+* @return this heap by reference
+*/
+template <class T, class Compare>
+PairingHeap<T, Compare>& PairingHeap<T, Compare>::operator=(PairingHeap&& other) noexcept {
+
+	if (this != &other) {
+
+		Walk::destroy(this->root);
+
+		this->root = other.root;
+		this->itemCount = other.itemCount;
+		this->comp = std::move(other.comp);
+
+		other.root = nullptr;
+		other.itemCount = PairingHeap::EMPTY;
+	}
+
+	return (*this);
+}
+
+/*
+* Add item to the heap
+* @param item The item to add to the heap
+*/
+template <class T, class Compare>
+void PairingHeap<T, Compare>::add(const T& item) {
+
+	this->root = this->link(this->root, new Node{item, nullptr, nullptr});
+	++this->itemCount;
+}
+
+/*
+* Add item to the heap by moving it
+* @param item The item to move into the heap
+*/
+template <class T, class Compare>
+void PairingHeap<T, Compare>::add(T&& item) {
+
+	this->root = this->link(this->root, new Node{std::move(item), nullptr, nullptr});
+	++this->itemCount;
+}
+
+/*
+* Remove the peek item in the heap
+*/
+template <class T, class Compare>
+void PairingHeap<T, Compare>::remove() {
+
+	if (this->root != nullptr) {
+
+		Node* removed = this->root;
+
+		this->root = this->combine(removed->child);
+		--this->itemCount;
+
+		delete removed;
+	}
+}
+
+/*
+* Remove the peek item in the heap and return it
+* @return the peek item, moved out of the heap
+*/
+template <class T, class Compare>
+T PairingHeap<T, Compare>::pop() {
+
+	if (this->root == nullptr) {
+
+		throw PairingHeap::EMPTY;
+	}
+
+	T top = std::move(this->root->item);
+
+	this->remove();
+
+	return top;
+}
+
+/*
+* Move every item of the other heap into this heap in O(1)
+* @param other The other heap, left empty
+*/
+template <class T, class Compare>
+void PairingHeap<T, Compare>::meld(PairingHeap&& other) {
+
+	if (this != &other) {
+
+		this->root = this->link(this->root, other.root);
+		this->itemCount += other.itemCount;
+
+		other.root = nullptr;
+		other.itemCount = PairingHeap::EMPTY;
+	}
+}
+
+/*
+* Check if item is in the heap
+* @param item The item to search for
+* @return true if found, else false
+*/
+template <class T, class Compare>
+bool PairingHeap<T, Compare>::contains(const T& item) const {
+
+	return Walk::contains(this->root, item, this->comp, true);
+}
+
+/*
+* Get the peek item in the heap
+* @return the peek item in the heap
+*/
+template <class T, class Compare>
+const T& PairingHeap<T, Compare>::peek() const {
+
+	if (this->root == nullptr) {
+
+		throw PairingHeap::EMPTY;
+	}
+
+	return this->root->item;
+}
+
+/*
+* Check if heap is empty
+* @return true if empty, else false
+*/
+template <class T, class Compare>
+bool PairingHeap<T, Compare>::isEmpty() const {
+
+	return this->root == nullptr;
+}
+
+/*
+* Get the number of nodes in the heap
+* @return the number of nodes in the heap
+*/
+template <class T, class Compare>
+int PairingHeap<T, Compare>::getNodes() const {
+
+	return this->itemCount;
+}
+
+/*
+* Clear the heap
+*/
+template <class T, class Compare>
+void PairingHeap<T, Compare>::clear() {
+
+	Walk::destroy(this->root);
+
+	this->root = nullptr;
+	this->itemCount = PairingHeap::EMPTY;
+}
+
+  //**************// //**************// //**************//
+ //*  PRIVATE:  *// //*  PRIVATE:  *// //*  PRIVATE:  *//
+//**************// //**************// //**************//
+
+/*
+* Links two roots, the one of lower priority becoming the first child of the other
+* @param node1 The first root, without siblings
+* @param node2 The second root, without siblings
+* @return the root of the linked heap
+*/
+template <class T, class Compare>
+typename PairingHeap<T, Compare>::Node* PairingHeap<T, Compare>::link(Node* node1, Node* node2) const {
+
+	if (node1 == nullptr) {
+
+		return node2;
+	}
+
+	if (node2 == nullptr) {
+
+		return node1;
+	}
+
+	if (this->comp(node1->item, node2->item)) {
+
+		std::swap(node1, node2);
+	}
+
+	node2->next = node1->child;
+	node1->child = node2;
+
+	return node1;
+}
+
+/*
+* Melds a list of siblings into one heap, in two passes
+* @param first The first sibling
+* @return the root of the heap, nullptr if the list is empty
+*/
+template <class T, class Compare>
+typename PairingHeap<T, Compare>::Node* PairingHeap<T, Compare>::combine(Node* first) const {
+
+	// Links siblings in pairs left to right, listing the pairs in reverse through next
+	Node* pairs = nullptr;
+
+	while (first != nullptr) {
+
+		Node* node1 = first;
+		Node* node2 = first->next;
+
+		first = (node2 != nullptr) ? node2->next : nullptr;
+
+		node1->next = nullptr;
+
+		if (node2 != nullptr) {
+
+			node2->next = nullptr;
+		}
+
+		Node* linked = this->link(node1, node2);
+
+		linked->next = pairs;
+		pairs = linked;
+	}
+
+	// Melds the pairs right to left
+	Node* root = nullptr;
+
+	while (pairs != nullptr) {
+
+		Node* next = pairs->next;
+
+		pairs->next = nullptr;
+		root = this->link(root, pairs);
+
+		pairs = next;
+	}
+
+	return root;
+}
+
@@ -0,0 +1,180 @@
+/*
+* pairingheap.h
+*
+* Specifications for PairingHeap class
+*
+* @author Juan Arias
+*
+*/
+
+#ifndef PAIRINGHEAP_H
+#define PAIRINGHEAP_H
+
+#include <functional>
+#include "nodewalk.h"
+
+/*
+* A PairingHeap is a pointer-based heap with the surface of the Heap interface
+* that melds in O(1): the root of lower priority becomes the first child of
+* the other. Adding is a meld with a single node, and removing the peek item
+* pairs up its children left to right, then melds the pairs right to left,
+* in O(log n) amortized. Suits workloads that meld often.
+*/
+template <class T, class Compare = std::less<T>>
+class PairingHeap {
+
+public:
+
+	/*
+	* Constructs empty heap
+	*/
+	PairingHeap();
+
+	/*
+	* Constructs empty heap ordered by given comparator
+	* @param comp The comparator to order the heap by
+	*/
+	explicit PairingHeap(const Compare& comp);
+
+	/*
+	* Constructs heap from given array
+	* @param arr The array to construct heap from
+	* @param size The size of arr
+	* @param comp The comparator to order the heap by
+	*/
+	PairingHeap(const T arr[], int size, const Compare& comp = Compare());
+
+	/*
+	* Copy constructor
+	* @param other The other heap to copy
+	*/
+	PairingHeap(const PairingHeap& other);
+
+	/*
+	* Move constructor
+	* @param other The other heap to move from, left empty
+	*/
+	PairingHeap(PairingHeap&& other) noexcept;
+
+	/*
+	* Destroys heap and deallocates all dynamic memory
+	*/
+	~PairingHeap();
+
+	/*
+	* Assignment operator
+	* @param other The other heap to copy
+	* @return this heap by reference
+	*/
+	PairingHeap& operator=(const PairingHeap& other);
+
+	/*
+	* Move assignment operator
+	* @param other The other heap to move from, left empty
+	* @return this heap by reference
+	*/
+	PairingHeap& operator=(PairingHeap&& other) noexcept;
+
+	/*
+	* Add item to the heap
+	* @param item The item to add to the heap
+	*/
+	void add(const T& item);
+
+	/*
+	* Add item to the heap by moving it
+	* @param item The item to move into the heap
+	*/
+	void add(T&& item);
+
+	/*
+	* Remove the peek item in the heap
+	*/
+	void remove();
+
+	/*
+	* Remove the peek item in the heap and return it
+	* @return the peek item, moved out of the heap
+	*/
+	T pop();
+
+	/*
+	* Move every item of the other heap into this heap in O(1)
+	* @param other The other heap, left empty
+	*/
+	void meld(PairingHeap&& other);
+
+	/*
+	* Check if item is in the heap
+	* @param item The item to search for
+	* @return true if found, else false
+	*/
+	bool contains(const T& item) const;
+
+	/*
+	* Get the peek item in the heap
+	* @return the peek item in the heap
+	*/
+	const T& peek() const;
+
+	/*
+	* Check if heap is empty
+	* @return true if empty, else false
+	*/
+	bool isEmpty() const;
+
+	/*
+	* Get the number of nodes in the heap
+	* @return the number of nodes in the heap
+	*/
+	int getNodes() const;
+
+	/*
+	* Clear the heap
+	*/
+	void clear();
+
+private:
+
+	// A node of the heap, linked to its first child & its next sibling
+	struct Node {
+
+		T item;
+		Node* child;
+		Node* next;
+	};
+
+	// Walks copying, deallocating & searching the nodes
+	using Walk = NodeWalk<T, Node, &Node::child, &Node::next>;
+
+	// Root of the heap
+	Node* root;
+
+	// Number of nodes in the heap
+	int itemCount;
+
+	// Comparator ordering the heap, comp(a, b) is true if b has priority
+	Compare comp;
+
+	// Constant for empty heap, thrown by peek
+	static const int EMPTY = 0;
+
+	/*
+	* Links two roots, the one of lower priority becoming the first child of the other
+	* @param node1 The first root, without siblings
+	* @param node2 The second root, without siblings
+	* @return the root of the linked heap
+	*/
+	Node* link(Node* node1, Node* node2) const;
+
+	/*
+	* Melds a list of siblings into one heap, in two passes
+	* @param first The first sibling
+	* @return the root of the heap, nullptr if the list is empty
+	*/
+	Node* combine(Node* first) const;
+
+};
+
+#include "pairingheap.cpp"
+#endif // PAIRINGHEAP_H
@@ -0,0 +1,60 @@
+#include "parallel.h"
+/*
+* parallel.cpp
+*
+* Implementations for fork-join helpers used by parallel heap functions
+*
+* @author Juan Arias
+*
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+/*
+* Runs task(i) for every i in [0, count) on up to threads threads, the calling
+* thread among them, returning once every task has run. Tasks are handed out
+* one at a time, so uneven tasks balance across threads, and threads that
+* fail to start leave their share to the rest. Tasks must not throw.
+* @param count The number of tasks
+* @param threads The number of threads to run on
+* @param task The task to run, called with the index of each task
+*/
+template <class Task>
+void parallelFor(int count, int threads, const Task& task) {
+
+	std::atomic<int> next(0);
+
+	auto work = [&next, count, &task] {
+
+		for (int i; (i = next.fetch_add(1)) < count;) {
+
+			task(i);
+		}
+	};
+
+	std::vector<std::thread> workers;
+	workers.reserve(std::max(std::min(threads, count) - 1, 0));
+
+	try {
+
+		for (int i(1); i < std::min(threads, count); ++i) {
+
+			workers.emplace_back(work);
+		}
+
+	} catch (const std::system_error&) {
+
+		// Out of threads, the ones started & this one run every task
+	}
+
+	work();
+
+	for (std::thread& worker : workers) {
+
+		worker.join();
+	}
+}
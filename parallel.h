@@ -0,0 +1,26 @@
+/*
+* parallel.h
+*
+* Specifications for fork-join helpers used by parallel heap functions
+*
+* @author Juan Arias
+*
+*/
+
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+/*
+* Runs task(i) for every i in [0, count) on up to threads threads, the calling
+* thread among them, returning once every task has run. Tasks are handed out
+* one at a time, so uneven tasks balance across threads, and threads that
+* fail to start leave their share to the rest. Tasks must not throw.
+* @param count The number of tasks
+* @param threads The number of threads to run on
+* @param task The task to run, called with the index of each task
+*/
+template <class Task>
+void parallelFor(int count, int threads, const Task& task);
+
+#include "parallel.cpp"
+#endif // PARALLEL_H
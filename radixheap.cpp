@@ -0,0 +1,275 @@
+#include "radixheap.h"
+/*
+* radixheap.cpp
+*
+* Implementations for RadixHeap class
+*
+* @author Juan Arias
+*
+*/
+
+#include <stdexcept>
+
+  //**************// //**************// //**************//
+ //*  PUBLIC:   *// //*  PUBLIC:   *// //*  PUBLIC:   *//
+//**************// //**************// //**************//
+
+/*
+* Constructs empty heap
+*/
+template <class Key, class Value>
+RadixHeap<Key, Value>::RadixHeap() :last(RadixHeap::toBits(std::numeric_limits<Key>::min())), itemCount(RadixHeap::EMPTY) {}
+
+/*
+* Add item to the heap
+* @param key The key of the item, not less than the last key removed
+* @param value The value of the item
+*/
+template <class Key, class Value>
+void RadixHeap<Key, Value>::add(Key key, const Value& value) {
+
+	this->insert(key, value);
+}
+
+/*
+* Add item to the heap by moving its value
+* @param key The key of the item, not less than the last key removed
+* @param value The value of the item to move into the heap
+*/
+template <class Key, class Value>
+void RadixHeap<Key, Value>::add(Key key, Value&& value) {
+
+	this->insert(key, std::move(value));
+}
+
+/*
+* Remove the item with the least key in the heap
+*/
+template <class Key, class Value>
+void RadixHeap<Key, Value>::remove() {
+
+	this->pop();
+}
+
+/*
+* Remove the item with the least key in the heap and return it
+* @return the item, moved out of the heap
+*/
+template <class Key, class Value>
+typename RadixHeap<Key, Value>::Item RadixHeap<Key, Value>::pop() {
+
+	if (this->itemCount == RadixHeap::EMPTY) {
+
+		throw RadixHeap::EMPTY;
+	}
+
+	this->redistribute();
+
+	Item top = std::move(this->buckets[0].back());
+
+	this->buckets[0].pop_back();
+	--this->itemCount;
+
+	return top;
+}
+
+/*
+* Get the item with the least key in the heap, O(1) while bucket 0 holds
+* items, else a scan of the lowest bucket that does
+* @return the item with the least key
+*/
+template <class Key, class Value>
+const typename RadixHeap<Key, Value>::Item& RadixHeap<Key, Value>::peek() const {
+
+	if (this->itemCount == RadixHeap::EMPTY) {
+
+		throw RadixHeap::EMPTY;
+	}
+
+	if (!this->buckets[0].empty()) {
+
+		return this->buckets[0].back();
+	}
+
+	const std::vector<Item>& lowest = this->buckets[this->lowestBucket()];
+	const Item* least = &lowest.front();
+
+	for (const Item& item : lowest) {
+
+		if (item.first < least->first) {
+
+			least = &item;
+		}
+	}
+
+	return *least;
+}
+
+/*
+* Get the last key removed, the least key that may be added
+* @return the last key removed
+*/
+template <class Key, class Value>
+Key RadixHeap<Key, Value>::getLast() const {
+
+	return static_cast<Key>(this->last ^ RadixHeap::toBits(0));
+}
+
+/*
+* Check if heap is empty
+* @return true if empty, else false
+*/
+template <class Key, class Value>
+bool RadixHeap<Key, Value>::isEmpty() const {
+
+	return this->itemCount == RadixHeap::EMPTY;
+}
+
+/*
+* Get the number of nodes in the heap
+* @return the number of nodes in the heap
+*/
+template <class Key, class Value>
+int RadixHeap<Key, Value>::getNodes() const {
+
+	return this->itemCount;
+}
+
+/*
+* Clear the heap, keeping the last key removed
+*/
+template <class Key, class Value>
+void RadixHeap<Key, Value>::clear() {
+
+	for (std::vector<Item>& bucket : this->buckets) {
+
+		bucket.clear();
+	}
+
+	this->itemCount = RadixHeap::EMPTY;
+}
+
+  //**************// //**************// //**************//
+ //*  PRIVATE:  *// //*  PRIVATE:  *// //*  PRIVATE:  *//
+//**************// //**************// //**************//
+
+/*
+* Adds item to its bucket
+* @param key The key of the item, not less than the last key removed
+* @param args The arguments to construct the value from
+*/
+template <class Key, class Value>
+template <class... Args>
+void RadixHeap<Key, Value>::insert(Key key, Args&&... args) {
+
+	Bits bits = RadixHeap::toBits(key);
+
+	if (bits < this->last) {
+
+		throw std::invalid_argument("RadixHeap key less than the last key removed");
+	}
+
+	this->buckets[this->bucket(bits)].emplace_back(key, std::forward<Args>(args)...);
+	++this->itemCount;
+}
+
+/*
+* Moves the items of the lowest bucket holding any into lower buckets,
+* the least key becoming the last key removed, if bucket 0 is empty
+*/
+template <class Key, class Value>
+void RadixHeap<Key, Value>::redistribute() {
+
+	if (!this->buckets[0].empty()) {
+
+		return;
+	}
+
+	std::vector<Item>& lowest = this->buckets[this->lowestBucket()];
+
+	Bits least = RadixHeap::toBits(lowest.front().first);
+
+	for (const Item& item : lowest) {
+
+		if (RadixHeap::toBits(item.first) < least) {
+
+			least = RadixHeap::toBits(item.first);
+		}
+	}
+
+	this->last = least;
+
+	// Every key now differs from last in a lower bit than before
+	for (Item& item : lowest) {
+
+		this->buckets[this->bucket(RadixHeap::toBits(item.first))].push_back(std::move(item));
+	}
+
+	lowest.clear();
+}
+
+/*
+* Gets the lowest bucket holding items above bucket 0
+* @return the bucket
+*/
+template <class Key, class Value>
+int RadixHeap<Key, Value>::lowestBucket() const {
+
+	int bucket(1);
+
+	while (this->buckets[bucket].empty()) {
+
+		++bucket;
+	}
+
+	return bucket;
+}
+
+/*
+* Gets the bucket of a key
+* @param key The key, as bits
+* @return the bucket
+*/
+template <class Key, class Value>
+int RadixHeap<Key, Value>::bucket(Bits key) const {
+
+	Bits differ = key ^ this->last;
+
+	if (differ == 0) {
+
+		return 0;
+	}
+
+#if defined(__GNUC__)
+	return std::numeric_limits<unsigned long long>::digits - __builtin_clzll(differ);
+#else
+	int bucket(0);
+
+	for (; differ != 0; differ >>= 1) {
+
+		++bucket;
+	}
+
+	return bucket;
+#endif
+}
+
+/*
+* Static method
+* Gets the bits of a key, ordered like the keys
+* @param key The key
+* @return the bits
+*/
+template <class Key, class Value>
+typename RadixHeap<Key, Value>::Bits RadixHeap<Key, Value>::toBits(Key key) {
+
+	Bits bits = static_cast<Bits>(key);
+
+	// Flipping the sign bit orders negative keys before positive ones
+	if (std::is_signed<Key>::value) {
+
+		bits ^= Bits(1) << (std::numeric_limits<Bits>::digits - 1);
+	}
+
+	return bits;
+}
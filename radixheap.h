@@ -0,0 +1,155 @@
+/*
+* radixheap.h
+*
+* Specifications for RadixHeap class
+*
+* @author Juan Arias
+*
+*/
+
+#ifndef RADIXHEAP_H
+#define RADIXHEAP_H
+
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*
+* A RadixHeap is a min-heap of integer keys, each with a value, for monotone
+* workloads such as timers & shortest paths: no key added may be less than the
+* last key removed. Items are kept in buckets by the highest bit their key
+* differs from the last key removed in. Removing from an empty bucket 0 moves
+* the next bucket's items into lower buckets, each item moving at most once
+* per bit, so operations take O(log C) amortized for keys in a range of C,
+* without comparing items.
+*/
+template <class Key, class Value>
+class RadixHeap {
+
+	static_assert(std::is_integral<Key>::value, "RadixHeap keys are integers");
+
+public:
+
+	// Type definition for items in the heap
+	using Item = std::pair<Key, Value>;
+
+	/*
+	* Constructs empty heap
+	*/
+	RadixHeap();
+
+	/*
+	* Add item to the heap
+	* @param key The key of the item, not less than the last key removed
+	* @param value The value of the item
+	*/
+	void add(Key key, const Value& value);
+
+	/*
+	* Add item to the heap by moving its value
+	* @param key The key of the item, not less than the last key removed
+	* @param value The value of the item to move into the heap
+	*/
+	void add(Key key, Value&& value);
+
+	/*
+	* Remove the item with the least key in the heap
+	*/
+	void remove();
+
+	/*
+	* Remove the item with the least key in the heap and return it
+	* @return the item, moved out of the heap
+	*/
+	Item pop();
+
+	/*
+	* Get the item with the least key in the heap, O(1) while bucket 0 holds
+	* items, else a scan of the lowest bucket that does
+	* @return the item with the least key
+	*/
+	const Item& peek() const;
+
+	/*
+	* Get the last key removed, the least key that may be added
+	* @return the last key removed
+	*/
+	Key getLast() const;
+
+	/*
+	* Check if heap is empty
+	* @return true if empty, else false
+	*/
+	bool isEmpty() const;
+
+	/*
+	* Get the number of nodes in the heap
+	* @return the number of nodes in the heap
+	*/
+	int getNodes() const;
+
+	/*
+	* Clear the heap, keeping the last key removed
+	*/
+	void clear();
+
+private:
+
+	// Type definition for keys as unsigned bits ordered like the keys
+	using Bits = typename std::make_unsigned<Key>::type;
+
+	// Constant for number of buckets, one per bit & one for the last key removed
+	static const int BUCKETS = std::numeric_limits<Bits>::digits + 1;
+
+	// Constant for empty heap, thrown by peek & pop
+	static const int EMPTY = 0;
+
+	// Items by the highest bit their key differs from last in, bucket 0 if equal
+	std::vector<Item> buckets[BUCKETS];
+
+	// Last key removed, as bits
+	Bits last;
+
+	// Number of items in the heap
+	int itemCount;
+
+	/*
+	* Adds item to its bucket
+	* @param key The key of the item, not less than the last key removed
+	* @param args The arguments to construct the value from
+	*/
+	template <class... Args>
+	void insert(Key key, Args&&... args);
+
+	/*
+	* Moves the items of the lowest bucket holding any into lower buckets,
+	* the least key becoming the last key removed, if bucket 0 is empty
+	*/
+	void redistribute();
+
+	/*
+	* Gets the lowest bucket holding items above bucket 0
+	* @return the bucket
+	*/
+	int lowestBucket() const;
+
+	/*
+	* Gets the bucket of a key
+	* @param key The key, as bits
+	* @return the bucket
+	*/
+	int bucket(Bits key) const;
+
+	/*
+	* Static method
+	* Gets the bits of a key, ordered like the keys
+	* @param key The key
+	* @return the bits
+	*/
+	static Bits toBits(Key key);
+
+};
+
+#include "radixheap.cpp"
+#endif // RADIXHEAP_H
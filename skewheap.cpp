@@ -0,0 +1,306 @@
+#include "skewheap.h"
+/*
+* skewheap.cpp
+*
+* Implementations for SkewHeap class
+*
+* @author Juan Arias
+*
+*/
+
+#include <utility>
+
+  //**************// //**************// //**************//
+ //*  PUBLIC:   *// //*  PUBLIC:   *// //*  PUBLIC:   *//
+//**************// //**************// //**************//
+
+/*
+* Constructs empty heap
+*/
+template <class T, class Compare>
+SkewHeap<T, Compare>::SkewHeap() :root(nullptr), itemCount(SkewHeap::EMPTY), comp() {}
+
+/*
+* Constructs empty heap ordered by given comparator
+* @param comp The comparator to order the heap by
+*/
+template <class T, class Compare>
+SkewHeap<T, Compare>::SkewHeap(const Compare& comp) :root(nullptr), itemCount(SkewHeap::EMPTY), comp(comp) {}
+
+/*
+* Constructs heap from given array
+* @param arr The array to construct heap from
+* @param size The size of arr
+* @param comp The comparator to order the heap by
+*/
+template <class T, class Compare>
+SkewHeap<T, Compare>::SkewHeap(const T arr[], int size, const Compare& comp) :SkewHeap(comp) {
+
+	for (int i(0); i < size; ++i) {
+
+		this->add(arr[i]);
+	}
+}
+
+/*
+* Copy constructor
+* @param other The other heap to copy
+*/
+template <class T, class Compare>
+SkewHeap<T, Compare>::SkewHeap(const SkewHeap& other)
+	:root(Walk::copy(other.root)), itemCount(other.itemCount), comp(other.comp) {}
+
+/*
+* Move constructor
+* @param other The other heap to move from, left empty
+*/
+template <class T, class Compare>
+SkewHeap<T, Compare>::SkewHeap(SkewHeap&& other) noexcept
+	:root(other.root), itemCount(other.itemCount), comp(std::move(other.comp)) {
+
+	other.root = nullptr;
+	other.itemCount = SkewHeap::EMPTY;
+}
+
+/*
+* Destroys heap and deallocates all dynamic memory
+*/
+template <class T, class Compare>
+SkewHeap<T, Compare>::~SkewHeap() {
+
+	Walk::destroy(this->root);
+}
+
+/*
+* Assignment operator
+* @param other The other heap to copy
+* @return this heap by reference
+*/
+template <class T, class Compare>
+SkewHeap<T, Compare>& SkewHeap<T, Compare>::operator=(const SkewHeap& other) {
+
+	if (this != &other) {
+
+		Node* copied = Walk::copy(other.root);
+
+		Walk::destroy(this->root);
+
+		this->root = copied;
+		this->itemCount = other.itemCount;
+		this->comp = other.comp;
+	}
+
+	return (*this);
+}
+
+/*
+* Move assignment operator
+* @param other The other heap to move from, left empty
+* @return this heap by reference
+*/
+template <class T, class Compare>
+SkewHeap<T, Compare>& SkewHeap<T, Compare>::operator=(SkewHeap&& other) noexcept {
+
+	if (this != &other) {
+
+		Walk::destroy(this->root);
+
+		this->root = other.root;
+		this->itemCount = other.itemCount;
+		this->comp = std::move(other.comp);
+
+		other.root = nullptr;
+		other.itemCount = SkewHeap::EMPTY;
+	}
+
+	return (*this);
+}
+
+/*
+* Add item to the heap
+* @param item The item to add to the heap
+*/
+template <class T, class Compare>
+void SkewHeap<T, Compare>::add(const T& item) {
+
+	this->root = this->merge(this->root, new Node{item, nullptr, nullptr});
+	++this->itemCount;
+}
+
+/*
+* Add item to the heap by moving it
+* @param item The item to move into the heap
+*/
+template <class T, class Compare>
+void SkewHeap<T, Compare>::add(T&& item) {
+
+	this->root = this->merge(this->root, new Node{std::move(item), nullptr, nullptr});
+	++this->itemCount;
+}
+
+/*
+* Remove the peek item in the heap
+*/
+template <class T, class Compare>
+void SkewHeap<T, Compare>::remove() {
+
+	if (this->root != nullptr) {
+
+		Node* removed = this->root;
+
+		this->root = this->merge(removed->left, removed->right);
+		--this->itemCount;
+
+		delete removed;
+	}
+}
+
+/*
+* Remove the peek item in the heap and return it
+* @return the peek item, moved out of the heap
+*/
+template <class T, class Compare>
+T SkewHeap<T, Compare>::pop() {
+
+	if (this->root == nullptr) {
+
+		throw SkewHeap::EMPTY;
+	}
+
+	T top = std::move(this->root->item);
+
+	this->remove();
+
+	return top;
+}
+
+/*
+* Move every item of the other heap into this heap in O(log n) amortized
+* @param other The other heap, left empty
+*/
+template <class T, class Compare>
+void SkewHeap<T, Compare>::meld(SkewHeap&& other) {
+
+	if (this != &other) {
+
+		this->root = this->merge(this->root, other.root);
+		this->itemCount += other.itemCount;
+
+		other.root = nullptr;
+		other.itemCount = SkewHeap::EMPTY;
+	}
+}
+
+/*
+* Check if item is in the heap
+* @param item The item to search for
+* @return true if found, else false
+*/
+template <class T, class Compare>
+bool SkewHeap<T, Compare>::contains(const T& item) const {
+
+	return Walk::contains(this->root, item, this->comp, false);
+}
+
+/*
+* Get the peek item in the heap
+* @return the peek item in the heap
+*/
+template <class T, class Compare>
+const T& SkewHeap<T, Compare>::peek() const {
+
+	if (this->root == nullptr) {
+
+		throw SkewHeap::EMPTY;
+	}
+
+	return this->root->item;
+}
+
+/*
+* Check if heap is empty
+* @return true if empty, else false
+*/
+template <class T, class Compare>
+bool SkewHeap<T, Compare>::isEmpty() const {
+
+	return this->root == nullptr;
+}
+
+/*
+* Get the number of nodes in the heap
+* @return the number of nodes in the heap
+*/
+template <class T, class Compare>
+int SkewHeap<T, Compare>::getNodes() const {
+
+	return this->itemCount;
+}
+
+/*
+* Clear the heap
+*/
+template <class T, class Compare>
+void SkewHeap<T, Compare>::clear() {
+
+	Walk::destroy(this->root);
+
+	this->root = nullptr;
+	this->itemCount = SkewHeap::EMPTY;
+}
+
+  //**************// //**************// //**************//
+ //*  PRIVATE:  *// //*  PRIVATE:  *// //*  PRIVATE:  *//
+//**************// //**************// //**************//
+
+/*
+* Merges two heaps along their right paths, iteratively
+* @param node1 The root of the first heap
+* @param node2 The root of the second heap
+* @return the root of the merged heap
+*/
+template <class T, class Compare>
+typename SkewHeap<T, Compare>::Node* SkewHeap<T, Compare>::merge(Node* node1, Node* node2) const {
+
+	if (node1 == nullptr) {
+
+		return node2;
+	}
+
+	if (node2 == nullptr) {
+
+		return node1;
+	}
+
+	if (this->comp(node1->item, node2->item)) {
+
+		std::swap(node1, node2);
+	}
+
+	Node* root = node1;
+
+	// The right child merged with node2 becomes the left child, the left child the right
+	for (Node* curr(node1);;) {
+
+		Node* right = curr->right;
+
+		curr->right = curr->left;
+
+		if (right == nullptr) {
+
+			curr->left = node2;
+			break;
+		}
+
+		if (this->comp(right->item, node2->item)) {
+
+			std::swap(right, node2);
+		}
+
+		curr->left = right;
+		curr = right;
+	}
+
+	return root;
+}
+
@@ -0,0 +1,173 @@
+/*
+* skewheap.h
+*
+* Specifications for SkewHeap class
+*
+* @author Juan Arias
+*
+*/
+
+#ifndef SKEWHEAP_H
+#define SKEWHEAP_H
+
+#include <functional>
+#include "nodewalk.h"
+
+/*
+* A SkewHeap is a pointer-based heap with the surface of the Heap interface
+* that melds in O(log n) amortized: the right paths of both heaps are merged
+* top-down, swapping the children of every node passed. Adding & removing
+* are melds too. Simpler & more predictable than a PairingHeap when adds &
+* removes are balanced.
+*/
+template <class T, class Compare = std::less<T>>
+class SkewHeap {
+
+public:
+
+	/*
+	* Constructs empty heap
+	*/
+	SkewHeap();
+
+	/*
+	* Constructs empty heap ordered by given comparator
+	* @param comp The comparator to order the heap by
+	*/
+	explicit SkewHeap(const Compare& comp);
+
+	/*
+	* Constructs heap from given array
+	* @param arr The array to construct heap from
+	* @param size The size of arr
+	* @param comp The comparator to order the heap by
+	*/
+	SkewHeap(const T arr[], int size, const Compare& comp = Compare());
+
+	/*
+	* Copy constructor
+	* @param other The other heap to copy
+	*/
+	SkewHeap(const SkewHeap& other);
+
+	/*
+	* Move constructor
+	* @param other The other heap to move from, left empty
+	*/
+	SkewHeap(SkewHeap&& other) noexcept;
+
+	/*
+	* Destroys heap and deallocates all dynamic memory
+	*/
+	~SkewHeap();
+
+	/*
+	* Assignment operator
+	* @param other The other heap to copy
+	* @return this heap by reference
+	*/
+	SkewHeap& operator=(const SkewHeap& other);
+
+	/*
+	* Move assignment operator
+	* @param other The other heap to move from, left empty
+	* @return this heap by reference
+	*/
+	SkewHeap& operator=(SkewHeap&& other) noexcept;
+
+	/*
+	* Add item to the heap
+	* @param item The item to add to the heap
+	*/
+	void add(const T& item);
+
+	/*
+	* Add item to the heap by moving it
+	* @param item The item to move into the heap
+	*/
+	void add(T&& item);
+
+	/*
+	* Remove the peek item in the heap
+	*/
+	void remove();
+
+	/*
+	* Remove the peek item in the heap and return it
+	* @return the peek item, moved out of the heap
+	*/
+	T pop();
+
+	/*
+	* Move every item of the other heap into this heap in O(log n) amortized
+	* @param other The other heap, left empty
+	*/
+	void meld(SkewHeap&& other);
+
+	/*
+	* Check if item is in the heap
+	* @param item The item to search for
+	* @return true if found, else false
+	*/
+	bool contains(const T& item) const;
+
+	/*
+	* Get the peek item in the heap
+	* @return the peek item in the heap
+	*/
+	const T& peek() const;
+
+	/*
+	* Check if heap is empty
+	* @return true if empty, else false
+	*/
+	bool isEmpty() const;
+
+	/*
+	* Get the number of nodes in the heap
+	* @return the number of nodes in the heap
+	*/
+	int getNodes() const;
+
+	/*
+	* Clear the heap
+	*/
+	void clear();
+
+private:
+
+	// A node of the heap, linked to its children
+	struct Node {
+
+		T item;
+		Node* left;
+		Node* right;
+	};
+
+	// Walks copying, deallocating & searching the nodes
+	using Walk = NodeWalk<T, Node, &Node::left, &Node::right>;
+
+	// Root of the heap
+	Node* root;
+
+	// Number of nodes in the heap
+	int itemCount;
+
+	// Comparator ordering the heap, comp(a, b) is true if b has priority
+	Compare comp;
+
+	// Constant for empty heap, thrown by peek
+	static const int EMPTY = 0;
+
+	/*
+	* Merges two heaps along their right paths, iteratively
+	* @param node1 The root of the first heap
+	* @param node2 The root of the second heap
+	* @return the root of the merged heap
+	*/
+	Node* merge(Node* node1, Node* node2) const;
+
+};
+
+#include "skewheap.cpp"
+#endif // SKEWHEAP_H
@@ -0,0 +1,360 @@
+#include "staticheap.h"
+/*
+* staticheap.cpp
+*
+* Implementations for StaticHeap class
+*
+* @author Juan Arias
+*
+*/
+
+#include <utility>
+
+  //**************// //**************// //**************//
+ //*  PUBLIC:   *// //*  PUBLIC:   *// //*  PUBLIC:   *//
+//**************// //**************// //**************//
+
+/*
+* Constructs empty heap
+* @param comp The comparator to order the heap by
+*/
+template <class T, int N, class Compare>
+constexpr StaticHeap<T, N, Compare>::StaticHeap(const Compare& comp) :StaticCompare<Compare>(comp), items{}, itemCount(StaticHeap::ROOT) {}
+
+/*
+* Constructs heap from given array, keeping its first N items at most
+* @param arr The array to construct heap from
+* @param size The size of arr
+* @param comp The comparator to order the heap by
+*/
+template <class T, int N, class Compare>
+constexpr StaticHeap<T, N, Compare>::StaticHeap(const T arr[], int size, const Compare& comp) :StaticHeap(comp) {
+
+	for (int i(0); i < size && i < N; ++i) {
+
+		this->items[i] = arr[i];
+	}
+
+	this->itemCount = static_cast<Size>(size < N ? (size > 0 ? size : 0) : N);
+
+	this->heapify();
+}
+
+/*
+* Add item to the heap, unless full
+* @param item The item to add to the heap
+* @return true if added, false if full
+*/
+template <class T, int N, class Compare>
+constexpr bool StaticHeap<T, N, Compare>::add(const T& item) {
+
+	return this->insert(item);
+}
+
+/*
+* Add item to the heap by moving it, unless full
+* @param item The item to move into the heap
+* @return true if added, false if full
+*/
+template <class T, int N, class Compare>
+constexpr bool StaticHeap<T, N, Compare>::add(T&& item) {
+
+	return this->insert(std::move(item));
+}
+
+/*
+* Remove the peek item in the heap
+*/
+template <class T, int N, class Compare>
+constexpr void StaticHeap<T, N, Compare>::remove() {
+
+	if (this->itemCount > StaticHeap::ROOT) {
+
+		--this->itemCount;
+
+		if (this->itemCount > StaticHeap::ROOT) {
+
+			// The last item lies past itemCount, so the hole never reaches it
+			this->bounce(std::move(this->items[this->itemCount]));
+		}
+	}
+}
+
+/*
+* Remove the peek item in the heap and return it
+* @return the peek item, moved out of the heap
+*/
+template <class T, int N, class Compare>
+constexpr T StaticHeap<T, N, Compare>::pop() {
+
+	if (this->itemCount == StaticHeap::ROOT) {
+
+		throw StaticHeap::EMPTY;
+	}
+
+	T top = std::move(this->items[StaticHeap::ROOT]);
+
+	this->remove();
+
+	return top;
+}
+
+/*
+* Get the peek item in the heap
+* @return the peek item in the heap
+*/
+template <class T, int N, class Compare>
+constexpr const T& StaticHeap<T, N, Compare>::peek() const {
+
+	if (this->itemCount == StaticHeap::ROOT) {
+
+		throw StaticHeap::EMPTY;
+	}
+
+	return this->items[StaticHeap::ROOT];
+}
+
+/*
+* Check if item is in the heap
+* @param item The item to search for
+* @return true if found, else false
+*/
+template <class T, int N, class Compare>
+constexpr bool StaticHeap<T, N, Compare>::contains(const T& item) const {
+
+	for (int curr(StaticHeap::ROOT); curr < this->itemCount; ++curr) {
+
+		if (this->items[curr] == item) {
+
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/*
+* Get the items in priority order, leaving the heap unchanged
+* @return the items, the rest of the array default constructed
+*/
+template <class T, int N, class Compare>
+constexpr std::array<T, N> StaticHeap<T, N, Compare>::sorted() const {
+
+	StaticHeap copy(*this);
+	std::array<T, N> ordered{};
+
+	for (int i(0); !copy.isEmpty(); ++i) {
+
+		ordered[i] = copy.pop();
+	}
+
+	return ordered;
+}
+
+/*
+* Check if heap is empty
+* @return true if empty, else false
+*/
+template <class T, int N, class Compare>
+constexpr bool StaticHeap<T, N, Compare>::isEmpty() const {
+
+	return this->itemCount == StaticHeap::ROOT;
+}
+
+/*
+* Check if heap holds N items
+* @return true if full, else false
+*/
+template <class T, int N, class Compare>
+constexpr bool StaticHeap<T, N, Compare>::isFull() const {
+
+	return this->itemCount == N;
+}
+
+/*
+* Get the number of nodes in the heap
+* @return the number of nodes in the heap
+*/
+template <class T, int N, class Compare>
+constexpr int StaticHeap<T, N, Compare>::getNodes() const {
+
+	return this->itemCount;
+}
+
+/*
+* Get the number of items the heap can hold
+* @return N
+*/
+template <class T, int N, class Compare>
+constexpr int StaticHeap<T, N, Compare>::getCapacity() {
+
+	return N;
+}
+
+/*
+* Clear the heap
+*/
+template <class T, int N, class Compare>
+constexpr void StaticHeap<T, N, Compare>::clear() {
+
+	for (int curr(StaticHeap::ROOT); curr < this->itemCount; ++curr) {
+
+		this->items[curr] = T();
+	}
+
+	this->itemCount = StaticHeap::ROOT;
+}
+
+  //**************// //**************// //**************//
+ //*  PRIVATE:  *// //*  PRIVATE:  *// //*  PRIVATE:  *//
+//**************// //**************// //**************//
+
+/*
+* Static method
+* Gets the most levels an item moves sifting a heap of N items
+* @return the height of a heap of N items
+*/
+template <class T, int N, class Compare>
+constexpr int StaticHeap<T, N, Compare>::height() {
+
+	int levels(0);
+
+	for (int nodes(N); nodes > 1; nodes /= 2) {
+
+		++levels;
+	}
+
+	return levels;
+}
+
+/*
+* Adds item to the heap, unless full
+* @param item The item to add, forwarded into the heap
+* @return true if added, false if full
+*/
+template <class T, int N, class Compare>
+template <class Item>
+constexpr bool StaticHeap<T, N, Compare>::insert(Item&& item) {
+
+	if (this->isFull()) {
+
+		return false;
+	}
+
+	this->items[this->itemCount] = std::forward<Item>(item);
+
+	this->bubbleUp(this->itemCount++);
+
+	return true;
+}
+
+/*
+* Forms heap from every item in the array, bottom-up
+*/
+template <class T, int N, class Compare>
+constexpr void StaticHeap<T, N, Compare>::heapify() {
+
+	for (int curr(this->itemCount / 2 - 1); curr >= StaticHeap::ROOT; --curr) {
+
+		this->rebuild(static_cast<Size>(curr));
+	}
+}
+
+/*
+* Bubbles node up heap until in correct position,
+* moving parents down into the hole left by the node
+* @param curr The current node in the heap
+*/
+template <class T, int N, class Compare>
+constexpr void StaticHeap<T, N, Compare>::bubbleUp(Size curr) {
+
+	T item = std::move(this->items[curr]);
+
+	// Bounded by the height of N, so small heaps unroll
+	for (int level(0); level < StaticHeap::height() && curr > StaticHeap::ROOT; ++level) {
+
+		Size parent = (curr - 1) / 2;
+
+		if (!this->comp()(this->items[parent], item)) {
+
+			break;
+		}
+
+		this->items[curr] = std::move(this->items[parent]);
+		curr = parent;
+	}
+
+	this->items[curr] = std::move(item);
+}
+
+/*
+* Trickles node down heap until in correct position,
+* moving children up into the hole left by the node
+* @param curr The current node in the heap
+*/
+template <class T, int N, class Compare>
+constexpr void StaticHeap<T, N, Compare>::rebuild(Size curr) {
+
+	T item = std::move(this->items[curr]);
+
+	// Bounded by the height of N, so small heaps unroll
+	for (int level(0); level < StaticHeap::height(); ++level) {
+
+		int larger = 2 * curr + 1;
+
+		if (larger >= this->itemCount) {
+
+			break;
+		}
+
+		if (larger + 1 < this->itemCount && this->comp()(this->items[larger], this->items[larger + 1])) {
+
+			++larger;
+		}
+
+		if (!this->comp()(item, this->items[larger])) {
+
+			break;
+		}
+
+		this->items[curr] = std::move(this->items[larger]);
+		curr = static_cast<Size>(larger);
+	}
+
+	this->items[curr] = std::move(item);
+}
+
+/*
+* Trickles the given item down from the root bottom-up: moves the larger
+* child up until reaching a leaf, then bounces the item back up to its
+* position, as the last item moved to the root belongs near the bottom
+* @param item The item to place, the root being a hole
+*/
+template <class T, int N, class Compare>
+constexpr void StaticHeap<T, N, Compare>::bounce(T&& item) {
+
+	Size curr = StaticHeap::ROOT;
+
+	// Bounded by the height of N, so small heaps unroll
+	for (int level(0); level < StaticHeap::height(); ++level) {
+
+		int larger = 2 * curr + 1;
+
+		if (larger >= this->itemCount) {
+
+			break;
+		}
+
+		if (larger + 1 < this->itemCount && this->comp()(this->items[larger], this->items[larger + 1])) {
+
+			++larger;
+		}
+
+		this->items[curr] = std::move(this->items[larger]);
+		curr = static_cast<Size>(larger);
+	}
+
+	this->items[curr] = std::move(item);
+
+	this->bubbleUp(curr);
+}
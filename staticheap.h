@@ -0,0 +1,229 @@
+/*
+* staticheap.h
+*
+* Specifications for StaticHeap class
+*
+* @author Juan Arias
+*
+*/
+
+#ifndef STATICHEAP_H
+#define STATICHEAP_H
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+/*
+* StaticCompare holds the comparator of a StaticHeap as a base, so a
+* comparator without state takes no space, or as a member if it cannot
+* be derived from
+*/
+template <class Compare, bool Empty = std::is_empty<Compare>::value && !std::is_final<Compare>::value>
+class StaticCompare : private Compare {
+
+protected:
+
+	/*
+	* Constructs holder of the given comparator
+	* @param comp The comparator
+	*/
+	constexpr explicit StaticCompare(const Compare& comp) :Compare(comp) {}
+
+	/*
+	* Gets the comparator, comp()(a, b) is true if b has priority
+	* @return the comparator
+	*/
+	constexpr const Compare& comp() const { return *this; }
+};
+
+template <class Compare>
+class StaticCompare<Compare, false> {
+
+protected:
+
+	/*
+	* Constructs holder of the given comparator
+	* @param comp The comparator
+	*/
+	constexpr explicit StaticCompare(const Compare& comp) :compare(comp) {}
+
+	/*
+	* Gets the comparator, comp()(a, b) is true if b has priority
+	* @return the comparator
+	*/
+	constexpr const Compare& comp() const { return this->compare; }
+
+private:
+
+	// Comparator ordering the heap
+	Compare compare;
+};
+
+/*
+* A StaticHeap is a binary heap of at most N items held inline in a
+* std::array, for small bounded queues: it never allocates, counts its items
+* in the narrowest unsigned type that holds N, and every operation is
+* constexpr, so heaps & sorted tables can be built at compile time. Sifts
+* loop at most the height of N, a bound the compiler unrolls for small N.
+* T must be default constructible.
+*/
+template <class T, int N, class Compare = std::less<T>>
+class StaticHeap : private StaticCompare<Compare> {
+
+	static_assert(N > 0, "StaticHeap holds at least one item");
+
+public:
+
+	/*
+	* Constructs empty heap
+	* @param comp The comparator to order the heap by
+	*/
+	constexpr explicit StaticHeap(const Compare& comp = Compare());
+
+	/*
+	* Constructs heap from given array, keeping its first N items at most
+	* @param arr The array to construct heap from
+	* @param size The size of arr
+	* @param comp The comparator to order the heap by
+	*/
+	constexpr StaticHeap(const T arr[], int size, const Compare& comp = Compare());
+
+	/*
+	* Add item to the heap, unless full
+	* @param item The item to add to the heap
+	* @return true if added, false if full
+	*/
+	constexpr bool add(const T& item);
+
+	/*
+	* Add item to the heap by moving it, unless full
+	* @param item The item to move into the heap
+	* @return true if added, false if full
+	*/
+	constexpr bool add(T&& item);
+
+	/*
+	* Remove the peek item in the heap
+	*/
+	constexpr void remove();
+
+	/*
+	* Remove the peek item in the heap and return it
+	* @return the peek item, moved out of the heap
+	*/
+	constexpr T pop();
+
+	/*
+	* Get the peek item in the heap
+	* @return the peek item in the heap
+	*/
+	constexpr const T& peek() const;
+
+	/*
+	* Check if item is in the heap
+	* @param item The item to search for
+	* @return true if found, else false
+	*/
+	constexpr bool contains(const T& item) const;
+
+	/*
+	* Get the items in priority order, leaving the heap unchanged
+	* @return the items, the rest of the array default constructed
+	*/
+	constexpr std::array<T, N> sorted() const;
+
+	/*
+	* Check if heap is empty
+	* @return true if empty, else false
+	*/
+	constexpr bool isEmpty() const;
+
+	/*
+	* Check if heap holds N items
+	* @return true if full, else false
+	*/
+	constexpr bool isFull() const;
+
+	/*
+	* Get the number of nodes in the heap
+	* @return the number of nodes in the heap
+	*/
+	constexpr int getNodes() const;
+
+	/*
+	* Get the number of items the heap can hold
+	* @return N
+	*/
+	static constexpr int getCapacity();
+
+	/*
+	* Clear the heap
+	*/
+	constexpr void clear();
+
+private:
+
+	// Type definition for node indexes, the narrowest unsigned type holding N
+	using Size = typename std::conditional<(N <= UINT8_MAX), std::uint8_t,
+	             typename std::conditional<(N <= UINT16_MAX), std::uint16_t, std::uint32_t>::type>::type;
+
+	// Constant for empty heap, thrown by peek & pop
+	static constexpr int EMPTY = 0;
+
+	// Constant for indexing root
+	static constexpr Size ROOT = 0;
+
+	// Items in the heap, the first itemCount in heap order
+	std::array<T, N> items;
+
+	// Item count in the array
+	Size itemCount;
+
+	/*
+	* Static method
+	* Gets the most levels an item moves sifting a heap of N items
+	* @return the height of a heap of N items
+	*/
+	static constexpr int height();
+
+	/*
+	* Adds item to the heap, unless full
+	* @param item The item to add, forwarded into the heap
+	* @return true if added, false if full
+	*/
+	template <class Item>
+	constexpr bool insert(Item&& item);
+
+	/*
+	* Forms heap from every item in the array, bottom-up
+	*/
+	constexpr void heapify();
+
+	/*
+	* Bubbles node up heap until in correct position,
+	* moving parents down into the hole left by the node
+	* @param curr The current node in the heap
+	*/
+	constexpr void bubbleUp(Size curr);
+
+	/*
+	* Trickles node down heap until in correct position,
+	* moving children up into the hole left by the node
+	* @param curr The current node in the heap
+	*/
+	constexpr void rebuild(Size curr);
+
+	/*
+	* Trickles the given item down from the root bottom-up: moves the larger
+	* child up until reaching a leaf, then bounces the item back up to its
+	* position, as the last item moved to the root belongs near the bottom
+	* @param item The item to place, the root being a hole
+	*/
+	constexpr void bounce(T&& item);
+
+};
+
+#include "staticheap.cpp"
+#endif // STATICHEAP_H
@@ -10,7 +10,36 @@
 #include <iostream>
 #include <string>
 #include <cassert>
+#include <cstdio>
+#include <cstdint>
+#include <csignal>
+#include <climits>
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+#include <system_error>
+#include <array>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <sys/resource.h>
 #include "maxheap.h"
+#include "minheap.h"
+#include "daryheap.h"
+#include "indexedheap.h"
+#include "heapsort.h"
+#include "concurrentheap.h"
+#include "lockfreeheap.h"
+#include "allocators.h"
+#include "mappedheap.h"
+#include "externalheap.h"
+#include "topk.h"
+#include "pairingheap.h"
+#include "skewheap.h"
+#include "radixheap.h"
+#include "keyedheap.h"
+#include "minmaxheap.h"
+#include "staticheap.h"
 
 /*
 * Unit tests for constructors & assignment operator overload
@@ -234,6 +263,1777 @@ void getHeight() {
 	assert(heap->getHeight() == 7);
 }
 
+/*
+* Unit test for growth, reserve & shrinkToFit
+*/
+void growth() {
+
+	Heap<int>* heap = new MaxHeap<int>();
+
+	assert(heap->getCapacity() == 0);
+
+	heap->setGrowthFactor(1.5);
+	assert(heap->getGrowthFactor() == 1.5);
+
+	heap->setGrowthFactor(0.5);
+	assert(heap->getGrowthFactor() == 1.5);
+
+	for (int i(0); i < 1000; ++i) {
+
+		heap->add(i);
+
+		assert(heap->getCapacity() >= heap->getNodes());
+		assert(heap->peek() == i);
+	}
+
+	assert(heap->getNodes() == 1000);
+
+	heap->add(heap->peek());
+	assert(heap->getNodes() == 1001);
+
+	heap->reserve(5000);
+	assert(heap->getCapacity() == 5000);
+	assert(heap->peek() == 999);
+
+	heap->shrinkToFit();
+	assert(heap->getCapacity() == 1001);
+
+	for (int i(999); i >= 0; --i) {
+
+		heap->remove();
+		assert(heap->peek() == i);
+	}
+
+	delete heap;
+}
+
+/*
+* Unit test for MinHeap & comparators
+*/
+void minHeap() {
+
+	int testArr[10]{5, 2, 8, 3, 1, 9, 7, 6, 4, 0};
+
+	MinHeap<int> heap(testArr, 10);
+
+	for (int i(0); i < 10; ++i) {
+
+		assert(heap.contains(i));
+		assert(heap.peek() == i);
+
+		heap.remove();
+	}
+
+	assert(heap.isEmpty());
+
+	BasicHeap<std::string, std::function<bool(const std::string&, const std::string&)>> byLength(
+		[](const std::string& a, const std::string& b) { return a.size() < b.size(); });
+
+	byLength.add("ACE");
+	byLength.add("MONSTER");
+	byLength.add("GYRO");
+
+	assert(byLength.peek() == "MONSTER");
+}
+
+/*
+* Unit test for add by move, emplace, pop & move operations
+*/
+void moveSemantics() {
+
+	MaxHeap<std::string> heap;
+
+	std::string word("MONSTER");
+	heap.add(std::move(word));
+	heap.emplace(4, 'Z');
+	heap.emplace("ACE");
+
+	assert(heap.getNodes() == 3);
+	assert(heap.pop() == "ZZZZ");
+
+	MaxHeap<std::string> moved(std::move(heap));
+
+	assert(heap.isEmpty());
+	assert(moved.pop() == "MONSTER");
+
+	heap = std::move(moved);
+
+	assert(moved.isEmpty());
+	assert(heap.pop() == "ACE");
+	assert(heap.isEmpty());
+
+	try {
+
+		heap.pop();
+		assert(false);
+
+	} catch (int) {}
+}
+
+/*
+* Unit test for DaryHeap
+*/
+void daryHeap() {
+
+	int testArr[10]{5, 2, 8, 3, 1, 9, 7, 6, 4, 0};
+
+	DaryHeap<int, 4> heap(testArr, 10);
+
+	for (int i(10); i < 1000; ++i) {
+
+		heap.add(i);
+	}
+
+	Heap<int>* copy = new DaryHeap<int, 8>(heap);
+
+	assert(heap.getHeight() == 6);
+	assert(copy->getHeight() == 5);
+
+	for (int i(999); i >= 0; --i) {
+
+		assert(heap.peek() == i);
+		assert(copy->peek() == i);
+
+		heap.remove();
+		copy->remove();
+	}
+
+	assert(heap.isEmpty());
+	assert(copy->isEmpty());
+
+	delete copy;
+}
+
+/*
+* Drains a heap built from keys and checks they come out in order
+* @param keys The keys to build the heap from
+* @param size The size of keys
+*/
+template <class T, class Compare>
+void drainsert(const T keys[], int size) {
+
+	DaryHeap<T, 8, Compare> heap(keys, size);
+
+	T last = heap.pop();
+
+	while (!heap.isEmpty()) {
+
+		assert(!Compare()(last, heap.peek()));
+
+		last = heap.pop();
+	}
+}
+
+/*
+* Unit test for SIMD child selection of arithmetic keys
+*/
+void childSelect() {
+
+	const int SIZE = 2000;
+
+	std::int32_t ints[SIZE];
+	std::int64_t longs[SIZE];
+	float floats[SIZE];
+	double doubles[SIZE];
+
+	for (int i(0); i < SIZE; ++i) {
+
+		ints[i] = (i * 7919) % 1009 - 500;
+		longs[i] = (i * 104729LL) % 100003 - (1LL << 40);
+		floats[i] = ((i * 31) % 97) / 3.0f;
+		doubles[i] = ((i * 17) % 89) * -1.5;
+	}
+
+	drainsert<std::int32_t, std::less<std::int32_t>>(ints, SIZE);
+	drainsert<std::int32_t, std::greater<std::int32_t>>(ints, SIZE);
+	drainsert<std::int64_t, std::less<std::int64_t>>(longs, SIZE);
+	drainsert<std::int64_t, std::greater<std::int64_t>>(longs, SIZE);
+	drainsert<float, std::less<float>>(floats, SIZE);
+	drainsert<float, std::greater<float>>(floats, SIZE);
+	drainsert<double, std::less<double>>(doubles, SIZE);
+	drainsert<double, std::greater<double>>(doubles, SIZE);
+
+	std::int32_t group[8]{3, 9, 1, 9, 7, 2, 9, 0};
+
+	assert((ChildSelect<std::int32_t, 8, std::less<std::int32_t>>::larger(group, std::less<std::int32_t>()) == 1));
+	assert((ChildSelect<std::int32_t, 8, std::greater<std::int32_t>>::larger(group, std::greater<std::int32_t>()) == 7));
+}
+
+/*
+* Unit test for IndexedHeap handles, update & erase
+*/
+void indexedHeap() {
+
+	IndexedHeap<int> heap;
+	IndexedHeap<int>::Handle handles[50];
+
+	for (int i(0); i < 50; ++i) {
+
+		handles[i] = heap.insert(i);
+	}
+
+	assert(heap.peek() == 49);
+	assert(heap.peekHandle().id == handles[49].id);
+
+	heap.update(handles[0], 100);
+	assert(heap.peek() == 100);
+	assert(heap.get(handles[0]) == 100);
+
+	heap.update(handles[0], -1);
+	assert(heap.peek() == 49);
+
+	heap.erase(handles[49]);
+	assert(!heap.contains(handles[49]));
+	assert(heap.peek() == 48);
+
+	for (int i(1); i < 40; ++i) {
+
+		heap.erase(handles[i]);
+		assert(!heap.contains(handles[i]));
+	}
+
+	IndexedHeap<int> copy(heap);
+
+	for (int i(48); i >= 40; --i) {
+
+		assert(copy.contains(handles[i]));
+		assert(copy.peekHandle().id == handles[i].id);
+
+		copy.remove();
+	}
+
+	assert(copy.peek() == -1);
+	assert(heap.getNodes() == 10);
+
+	IndexedHeap<int>::Handle reused = heap.insert(7);
+	assert(heap.get(reused) == 7);
+
+	// A reused id does not revive the handle of the item removed before
+	assert(reused.id == handles[39].id && !heap.contains(handles[39]));
+
+	bool thrown = false;
+
+	try {
+
+		heap.update(handles[39], 42);
+
+	} catch (const std::invalid_argument& e) {
+
+		thrown = true;
+	}
+
+	assert(thrown && heap.get(reused) == 7);
+
+	// Moving through the Heap interface clears the other heap's handles
+	IndexedHeap<int> moved;
+	IndexedHeap<int>::Handle first = moved.insert(1);
+	IndexedHeap<int> target;
+
+	static_cast<Heap<int>&>(target) = std::move(moved);
+	assert(!moved.contains(first) && moved.isEmpty() && target.peek() == 1);
+
+	moved.insert(2);
+	assert(!moved.contains(first));
+
+	Heap<int>* base = new IndexedHeap<int>;
+	(*base) = heap;
+	assert(*base == heap);
+
+	base->clear();
+	assert(base->isEmpty());
+
+	delete base;
+}
+
+/*
+* Unit test for contains through a HashIndex
+*/
+void hashIndex() {
+
+	using HashedHeap = BasicHeap<std::string, std::less<std::string>, Heap<std::string>, 2,
+	                             HashIndex<std::string>>;
+
+	std::string testArr[10]{ "GYRO", "CISCO", "POPS", "DISK", "BASE", "QUAVO",
+	                         "MONSTER", "JACKA", "ELON", "ACE" };
+
+	HashedHeap heap(testArr, 10);
+
+	for (std::string word : testArr) {
+
+		assert(heap.contains(word));
+	}
+
+	heap.add("QUAVO");
+	heap.remove();
+	assert(heap.contains("QUAVO"));
+
+	heap.remove();
+	assert(!heap.contains("QUAVO"));
+	assert(!heap.contains("ZED"));
+
+	// pop erases the popped item, not the one moved into the root
+	assert(heap.pop() == "POPS" && !heap.contains("POPS"));
+	heap.add("POPS");
+
+	HashedHeap copy(heap);
+	heap.clear();
+
+	assert(!heap.contains("POPS"));
+	assert(copy.contains("POPS"));
+
+	heap = std::move(copy);
+
+	assert(heap.contains("ACE"));
+	assert(!copy.contains("ACE"));
+
+	// Moving through the Heap interface clears the other heap's index
+	copy = heap;
+	static_cast<Heap<std::string>&>(heap) = std::move(copy);
+
+	assert(heap.contains("ACE") && copy.isEmpty() && !copy.contains("ACE"));
+
+	HashedHeap constructed(std::move(static_cast<Heap<std::string>&>(heap)));
+
+	assert(constructed.contains("ACE") && !heap.contains("ACE"));
+
+	// Moving a heap into itself keeps its items & their index
+	HashedHeap& alias = constructed;
+	int nodes = constructed.getNodes();
+
+	constructed = std::move(alias);
+	static_cast<Heap<std::string>&>(constructed) = std::move(static_cast<Heap<std::string>&>(alias));
+
+	assert(constructed.getNodes() == nodes && constructed.contains("ACE"));
+}
+
+/*
+* Unit test for addRange
+*/
+void addRange() {
+
+	MaxHeap<int> heap;
+
+	int few[3]{1000, -5, 17};
+	std::string words[4]{"GYRO", "CISCO", "POPS", "DISK"};
+
+	for (int i(0); i < 500; ++i) {
+
+		heap.add((i * 37) % 500);
+	}
+
+	heap.addRange(few, few + 3);
+	assert(heap.getNodes() == 503);
+	assert(heap.pop() == 1000);
+
+	int many[2000];
+
+	for (int i(0); i < 2000; ++i) {
+
+		many[i] = (i * 7919) % 2000 + 500;
+	}
+
+	heap.addRange(many, many + 2000);
+	assert(heap.getNodes() == 2502);
+
+	int last = heap.pop();
+
+	while (!heap.isEmpty()) {
+
+		assert(last >= heap.peek());
+		last = heap.pop();
+	}
+
+	assert(last == -5);
+
+	MinHeap<std::string> strings;
+	strings.addRange(words, words + 4);
+
+	assert(strings.pop() == "CISCO");
+	assert(strings.pop() == "DISK");
+}
+
+/*
+* Unit test for maxHeapSort, heapSort & partialSortTopK
+*/
+void heapSort() {
+
+	for (int size : {0, 1, 2, 10, 16, 17, 100, 1000}) {
+
+		std::vector<int> keys(size);
+
+		for (int i(0); i < size; ++i) {
+
+			keys[i] = (i * 7919) % 257 - 128;
+		}
+
+		std::vector<int> expected(keys);
+		std::sort(expected.begin(), expected.end());
+
+		std::vector<int> sorted(keys);
+		MaxHeap<int>::maxHeapSort(sorted.data(), size);
+		assert(sorted == expected);
+
+		sorted = keys;
+		DaryHeap<int, 4>::maxHeapSort(sorted.data(), size);
+		assert(sorted == expected);
+
+		sorted = keys;
+		heapSort(sorted.begin(), sorted.end());
+		assert(sorted == expected);
+
+		for (int k : {0, 1, 5, 16, 17, size / 2, size}) {
+
+			if (k <= size) {
+
+				sorted = keys;
+				partialSortTopK(sorted.begin(), sorted.begin() + k, sorted.end());
+				assert(std::equal(sorted.begin(), sorted.begin() + k, expected.begin()));
+
+				std::sort(sorted.begin(), sorted.end());
+				assert(sorted == expected);
+			}
+		}
+	}
+
+	std::string words[10]{ "GYRO", "CISCO", "POPS", "DISK", "BASE", "QUAVO",
+	                       "MONSTER", "JACKA", "ELON", "ACE" };
+
+	partialSortTopK(words, words + 3, words + 10, std::greater<std::string>());
+
+	assert(words[0] == "QUAVO");
+	assert(words[1] == "POPS");
+	assert(words[2] == "MONSTER");
+}
+
+/*
+* Unit test for pushBatch & popBatch
+*/
+void batches() {
+
+	for (int size : {0, 1, 2, 10, 100, 1000}) {
+
+		for (int batch : {1, 2, 5, 64, 2000}) {
+
+			std::vector<int> keys(size);
+
+			for (int i(0); i < size; ++i) {
+
+				keys[i] = (i * 7919) % 257;
+			}
+
+			MaxHeap<int> heap(keys.data(), size / 2);
+			DaryHeap<int, 4> dary(keys.data(), size / 2);
+			MaxHeap<int> expected(keys.data(), size);
+
+			heap.pushBatch(keys.data() + size / 2, size - size / 2);
+			dary.pushBatch(keys.data() + size / 2, size - size / 2);
+
+			assert(heap.getNodes() == expected.getNodes());
+
+			std::vector<int> out(batch), daryOut(batch);
+
+			while (!expected.isEmpty()) {
+
+				int popped = heap.popBatch(batch, out.data());
+				assert(dary.popBatch(batch, daryOut.data()) == popped);
+				assert(popped == std::min(batch, expected.getNodes()));
+
+				for (int i(0); i < popped; ++i) {
+
+					int top = expected.pop();
+					assert(out[i] == top && daryOut[i] == top);
+				}
+
+				assert(heap.getNodes() == expected.getNodes());
+			}
+
+			assert(heap.popBatch(batch, out.data()) == 0);
+		}
+	}
+
+	using HashedHeap = BasicHeap<std::string, std::less<std::string>, Heap<std::string>, 2,
+	                             HashIndex<std::string>>;
+
+	std::string testArr[10]{ "GYRO", "CISCO", "POPS", "DISK", "BASE", "QUAVO",
+	                         "MONSTER", "JACKA", "ELON", "ACE" };
+
+	HashedHeap words;
+	words.pushBatch(testArr, 10);
+
+	std::string top[3];
+
+	assert(words.popBatch(3, top) == 3);
+	assert(top[0] == "QUAVO" && top[1] == "POPS" && top[2] == "MONSTER");
+	assert(!words.contains("POPS") && words.contains("JACKA"));
+	assert(words.peek() == "JACKA");
+
+	ConcurrentHeap<int> shared(1, 1);
+
+	int items[5]{ 5, 1, 9, 3, 7 };
+	int out[5];
+
+	shared.pushBatch(items, 5);
+	assert(shared.size() == 5);
+	assert(shared.popBatch(2, out) == 2 && out[0] == 9 && out[1] == 7);
+	assert(shared.popBatch(5, out) == 3 && out[0] == 5 && out[2] == 1);
+	assert(shared.isEmpty());
+}
+
+/*
+* Unit test for ConcurrentHeap
+*/
+void concurrentHeap() {
+
+	// A single shard is an exact heap
+	ConcurrentHeap<int> exact(1, 1);
+
+	int item(0);
+	assert(!exact.tryPop(item));
+
+	for (int i : {5, 1, 9, 3, 7}) {
+
+		assert(exact.tryPush(i));
+	}
+
+	assert(exact.size() == 5);
+	assert(exact.pop() == 9);
+	assert(exact.tryPop(item) && item == 7);
+
+	ConcurrentHeap<std::string, std::greater<std::string>> words(2, 2);
+	assert(words.getShards() == 4);
+
+	words.push("POPS");
+	words.push("ACE");
+	assert(words.pop() <= "POPS");
+
+	// Every item pushed by producers is popped exactly once by consumers
+	const int THREADS = 4, ITEMS = 10000;
+
+	ConcurrentHeap<int> shared(THREADS);
+	std::vector<long long> sums(THREADS, 0);
+	std::vector<std::thread> threads;
+
+	for (int t(0); t < THREADS; ++t) {
+
+		threads.emplace_back([&shared, t] {
+
+			for (int i(0); i < ITEMS; ++i) {
+
+				shared.push(t * ITEMS + i);
+			}
+		});
+
+		threads.emplace_back([&shared, &sums, t] {
+
+			for (int i(0); i < ITEMS; ++i) {
+
+				sums[t] += shared.pop();
+			}
+		});
+	}
+
+	for (std::thread& thread : threads) {
+
+		thread.join();
+	}
+
+	long long total(0), n(static_cast<long long>(THREADS) * ITEMS);
+
+	for (long long sum : sums) {
+
+		total += sum;
+	}
+
+	assert(total == n * (n - 1) / 2);
+	assert(shared.isEmpty() && !shared.tryPop(item));
+}
+
+/*
+* Unit test for LockFreeHeap
+*/
+void lockFreeHeap() {
+
+	LockFreeHeap<std::string> words;
+
+	assert(words.isEmpty());
+
+	try {
+
+		words.peek();
+		assert(false);
+
+	} catch (int e) {}
+
+	std::string testArr[10]{ "GYRO", "CISCO", "POPS", "DISK", "BASE", "QUAVO",
+	                         "MONSTER", "JACKA", "ELON", "ACE" };
+
+	for (const std::string& word : testArr) {
+
+		words.add(word);
+	}
+
+	assert(words.peek() == "QUAVO");
+	assert(words.contains("ELON"));
+	assert(!words.contains("ZED"));
+
+	words.remove();
+	assert(words.peek() == "POPS");
+	assert(!words.contains("QUAVO"));
+
+	std::string word;
+	std::string previous("POPS");
+
+	while (words.tryPop(word)) {
+
+		assert(word <= previous);
+		previous = word;
+	}
+
+	assert(word == "ACE" && words.isEmpty());
+
+	// Removes far past the bound, so deleted nodes are unlinked & reclaimed
+	LockFreeHeap<int, std::greater<int>> ints;
+
+	for (int i(999); i >= 0; --i) {
+
+		ints.add(i);
+	}
+
+	for (int i(0); i < 1000; ++i) {
+
+		int item(-1);
+		assert(ints.tryPop(item) && item == i);
+	}
+
+	// Every item added by producers is removed exactly once by consumers
+	const int THREADS = 4, ITEMS = 10000;
+
+	LockFreeHeap<int> shared;
+	std::vector<long long> sums(THREADS, 0);
+	std::vector<std::thread> threads;
+
+	for (int t(0); t < THREADS; ++t) {
+
+		threads.emplace_back([&shared, t] {
+
+			for (int i(0); i < ITEMS; ++i) {
+
+				shared.add(t * ITEMS + i);
+			}
+		});
+
+		threads.emplace_back([&shared, &sums, t] {
+
+			for (int i(0); i < ITEMS;) {
+
+				int item;
+
+				if (shared.tryPop(item)) {
+
+					sums[t] += item;
+					++i;
+				}
+			}
+		});
+	}
+
+	for (std::thread& thread : threads) {
+
+		thread.join();
+	}
+
+	long long total(0), n(static_cast<long long>(THREADS) * ITEMS);
+
+	for (long long sum : sums) {
+
+		total += sum;
+	}
+
+	assert(total == n * (n - 1) / 2);
+	assert(shared.isEmpty());
+}
+
+/*
+* Unit test for Heap allocators
+*/
+void allocators() {
+
+	using ArenaHeap = BasicHeap<std::string, std::less<std::string>, Heap<std::string, ArenaAllocator<std::string>>>;
+	using PoolHeap = BasicHeap<int, std::less<int>, Heap<int, PoolAllocator<int>>, 4>;
+
+	Arena arena(1024), other(1024);
+
+	ArenaHeap words(std::in_place, ArenaAllocator<std::string>(arena));
+
+	std::string testArr[10]{ "GYRO", "CISCO", "POPS", "DISK", "BASE", "QUAVO",
+	                         "MONSTER", "JACKA", "ELON", "ACE" };
+
+	for (const std::string& word : testArr) {
+
+		words.add(word);
+	}
+
+	assert(words.peek() == "QUAVO");
+	assert(words.getAllocator() == ArenaAllocator<std::string>(arena));
+
+	// Copies allocate from the arena of the heap copied
+	ArenaHeap copy(words);
+	assert(copy.getAllocator() == ArenaAllocator<std::string>(arena));
+	assert(copy.pop() == "QUAVO" && words.peek() == "QUAVO");
+
+	// Moving between arenas moves every item, the array stays with its arena
+	ArenaHeap moved(std::in_place, ArenaAllocator<std::string>(other));
+	moved = std::move(words);
+
+	assert(moved.getNodes() == 10 && words.isEmpty());
+	assert(moved.getAllocator() == ArenaAllocator<std::string>(other));
+	assert(moved.pop() == "QUAVO" && moved.pop() == "POPS");
+
+	PoolHeap ints;
+
+	for (int round(0); round < 3; ++round) {
+
+		for (int i(0); i < 1000; ++i) {
+
+			ints.add((i * 7919) % 1000);
+		}
+
+		for (int i(999); i >= 0; --i) {
+
+			assert(ints.pop() == i);
+		}
+
+		ints.shrinkToFit();
+	}
+
+	// Arrays past the largest pooled size class bypass the free lists
+	PoolHeap big;
+	big.reserve(1 << 19);
+	big.add(1);
+	big.add(2);
+	assert(big.pop() == 2 && big.pop() == 1);
+	big.shrinkToFit();
+
+	// Arrays past a huge page are aligned to one, smaller ones to a cache line
+	MaxHeap<int> large;
+	large.reserve(1 << 20);
+	large.add(1);
+
+	MaxHeap<int> small;
+	small.add(1);
+
+	assert((reinterpret_cast<std::uintptr_t>(&large.peek()) - sizeof(int)) % (1 << 21) == 0);
+	assert((reinterpret_cast<std::uintptr_t>(&small.peek()) - sizeof(int)) % 64 == 0);
+}
+
+/*
+* Unit test for MappedHeap
+*/
+void mappedHeap() {
+
+	const std::string path("test.heap"), copy("test-copy.heap");
+
+	std::remove(path.c_str());
+
+	{
+		MappedHeap<int> heap(std::in_place, path);
+
+		assert(heap.isEmpty());
+
+		for (int i(0); i < 1000; ++i) {
+
+			heap.add((i * 7919) % 1000);
+		}
+
+		assert(heap.pop() == 999 && heap.pop() == 998);
+	}
+
+	// Reopens the heap as it was closed
+	{
+		MappedHeap<int> heap(std::in_place, path);
+
+		assert(heap.getNodes() == 998 && heap.getCapacity() >= 998);
+
+		for (int i(997); i > 500; --i) {
+
+			assert(heap.pop() == i);
+		}
+
+		heap.checkpoint();
+
+		// A file copied while open is the file a crash would leave
+		std::ofstream(copy, std::ios::binary) << std::ifstream(path, std::ios::binary).rdbuf();
+
+		{
+			MappedHeap<int> crashed(std::in_place, copy);
+
+			assert(crashed.getNodes() == 501 && crashed.peek() == 500);
+		}
+
+		heap.add(5000);
+
+		std::ofstream(copy, std::ios::binary) << std::ifstream(path, std::ios::binary).rdbuf();
+
+		bool thrown(false);
+
+		try {
+
+			MappedHeap<int> crashed(std::in_place, copy);
+
+		} catch (const std::runtime_error&) {
+
+			thrown = true;
+		}
+
+		assert(thrown);
+
+		// Recovering takes the checkpointed slots as they are & forms a heap again
+		{
+			MappedHeap<int> crashed(std::in_place, copy, true);
+
+			assert(crashed.getNodes() == 501 && crashed.pop() == 5000);
+
+			for (int i(crashed.pop()); !crashed.isEmpty(); ) {
+
+				int next(crashed.pop());
+				assert(next <= i);
+				i = next;
+			}
+		}
+
+		heap.clear();
+		assert(heap.isEmpty());
+	}
+
+	// Files of another type or arity are refused
+	bool thrown(false);
+
+	try {
+
+		MappedHeap<int, std::less<int>, 4> heap(std::in_place, path);
+
+	} catch (const std::runtime_error&) {
+
+		thrown = true;
+	}
+
+	assert(thrown);
+
+	{
+		MappedHeap<int> heap(std::in_place, path);
+		assert(heap.isEmpty());
+
+		MaxHeap<int> other;
+		other.add(3);
+		other.add(7);
+
+		// Copies grow the file through Heap
+		static_cast<Heap<int>&>(heap) = other;
+		assert(heap.getNodes() == 2 && heap.peek() == 7);
+	}
+
+	// Heaps moved from a mapped heap take its items, never its mapping
+	{
+		MappedHeap<int> heap(std::in_place, path);
+
+		heap.clear();
+		heap.add(4);
+		heap.add(9);
+
+		MaxHeap<int> moved(std::move(static_cast<Heap<int>&>(heap)));
+		assert(moved.getNodes() == 2 && moved.peek() == 9 && heap.isEmpty());
+
+		heap.add(1);
+		heap.add(6);
+
+		MaxHeap<int> assigned;
+		static_cast<Heap<int>&>(assigned) = std::move(static_cast<Heap<int>&>(heap));
+		assert(assigned.pop() == 6 && assigned.pop() == 1 && heap.isEmpty());
+
+		heap.add(2);
+		assert(heap.peek() == 2);
+	}
+
+	std::remove(path.c_str());
+	std::remove(copy.c_str());
+}
+
+/*
+* Unit test for ExternalHeap
+*/
+void externalHeap() {
+
+	// 128 items in memory, blocks of 16 & 8 runs before merging
+	ExternalHeap<int> heap(1024, 64, ".");
+
+	assert(heap.isEmpty());
+
+	for (int i(0); i < 10000; ++i) {
+
+		heap.add((i * 7919) % 10000);
+	}
+
+	assert(heap.size() == 10000 && heap.getRuns() > 1 && heap.getRuns() <= 8);
+	assert(heap.peek() == 9999);
+
+	for (int i(9999); i >= 5000; --i) {
+
+		assert(heap.pop() == i);
+	}
+
+	// Items added after spilling are merged with the runs
+	heap.add(7000);
+	heap.add(10);
+
+	assert(heap.pop() == 7000 && heap.pop() == 4999);
+
+	ExternalHeap<int, std::greater<int>> minimums(1024, 64, ".");
+
+	for (int i(0); i < 1000; ++i) {
+
+		minimums.add(1000 - i);
+	}
+
+	assert(minimums.pop() == 1 && minimums.peek() == 2);
+
+	heap.clear();
+	assert(heap.isEmpty() && heap.getRuns() == 0);
+
+	bool thrown(false);
+
+	try {
+
+		heap.pop();
+
+	} catch (int) {
+
+		thrown = true;
+	}
+
+	assert(thrown);
+
+	// A spill that fails to write its run, or to merge runs first, loses no item
+	rlimit limit, small;
+	getrlimit(RLIMIT_FSIZE, &limit);
+
+	// Only the soft limit is lowered, so it can be raised back
+	small = limit;
+	small.rlim_cur = 256;
+	std::signal(SIGXFSZ, SIG_IGN);
+
+	for (int runs : { 0, 8 }) {
+
+		heap.clear();
+
+		for (int i(0); i < 128 * (runs + 1); ++i) {
+
+			heap.add(i);
+		}
+
+		setrlimit(RLIMIT_FSIZE, &small);
+
+		thrown = false;
+
+		try {
+
+			heap.add(-1);
+
+		} catch (const std::system_error&) {
+
+			thrown = true;
+		}
+
+		setrlimit(RLIMIT_FSIZE, &limit);
+
+		assert(thrown && heap.size() == 128 * (runs + 1) && heap.getRuns() == runs);
+
+		for (int i(128 * (runs + 1) - 1); i >= 0; --i) {
+
+			assert(heap.pop() == i);
+		}
+
+		assert(heap.isEmpty());
+	}
+
+	std::signal(SIGXFSZ, SIG_DFL);
+}
+
+/*
+* Unit test for TopK & replaceTop
+*/
+void topK() {
+
+	MaxHeap<int> heap;
+
+	for (int i(0); i < 10; ++i) {
+
+		heap.add(i);
+	}
+
+	heap.replaceTop(-1);
+	assert(heap.getNodes() == 10 && heap.pop() == 8);
+
+	heap.replaceTop(20);
+	assert(heap.pop() == 20 && heap.pop() == 6);
+
+	TopK<int> best(5);
+
+	assert(best.isEmpty() && best.getK() == 5);
+
+	for (int i(0); i < 1000; ++i) {
+
+		best.add((i * 7919) % 1000);
+	}
+
+	assert(best.size() == 5 && best.peek() == 995);
+	assert(!best.add(900) && best.add(1000) && best.peek() == 996);
+
+	std::vector<int> expected{ 1000, 999, 998, 997, 996 };
+	assert(best.sortedResult() == expected);
+
+	// Per thread selectors merged into one
+	TopK<int> first(3), second(3);
+
+	for (int i(0); i < 100; ++i) {
+
+		(i % 2 == 0 ? first : second).add(i);
+	}
+
+	first.merge(second);
+
+	expected = { 99, 98, 97 };
+	assert(first.sortedResult() == expected);
+
+	first.merge(first);
+	assert(first.sortedResult() == expected);
+
+	TopK<std::string, std::greater<std::string>> least(2);
+
+	std::string testArr[6]{ "GYRO", "CISCO", "POPS", "DISK", "BASE", "ACE" };
+	least.addRange(testArr, testArr + 6);
+
+	assert(least.sortedResult() == std::vector<std::string>({ "ACE", "BASE" }));
+
+	TopK<int> none(0);
+	assert(!none.add(1) && none.isEmpty());
+
+	best.clear();
+	assert(best.isEmpty() && best.add(1));
+}
+
+/*
+* Unit test for parallel heapify & heap sort
+*/
+void parallelHeap() {
+
+	const int size = 300007;
+
+	std::vector<int> keys(size);
+
+	for (int i(0); i < size; ++i) {
+
+		keys[i] = static_cast<int>((i * 7919LL) % size);
+	}
+
+	for (int threads : { 1, 2, 3, 8 }) {
+
+		MaxHeap<int> heap(keys.data(), size, std::less<int>(), threads);
+		DaryHeap<int, 4> dary(keys.data(), size, std::less<int>(), threads);
+
+		for (int i(size - 1); i >= size - 1000; --i) {
+
+			assert(heap.pop() == i && dary.pop() == i);
+		}
+
+		std::vector<int> sorted(keys);
+		MaxHeap<int>::maxHeapSort(sorted.data(), size, std::less<int>(), threads);
+
+		for (int i(0); i < size; ++i) {
+
+			assert(sorted[i] == i);
+		}
+
+		std::vector<std::string> words{ "GYRO", "CISCO", "POPS", "DISK", "BASE" };
+		MinHeap<std::string>::maxHeapSort(words.data(), 5, std::greater<std::string>(), threads);
+
+		assert(words.front() == "POPS" && words.back() == "BASE");
+	}
+}
+
+/*
+* Unit test for melding heaps of every backend
+*/
+template <class HeapType>
+void meldsert() {
+
+	HeapType evens, odds;
+
+	for (int i(0); i < 1000; ++i) {
+
+		(i % 2 == 0 ? evens : odds).add((i * 7919) % 1000);
+	}
+
+	assert(evens.contains(998) && !evens.contains(999) && !evens.contains(1000));
+
+	HeapType copy(evens);
+
+	evens.meld(std::move(odds));
+
+	assert(evens.getNodes() == 1000 && odds.isEmpty());
+	assert(copy.getNodes() == 500 && copy.pop() == 998);
+
+	for (int i(999); i >= 0; --i) {
+
+		assert(evens.peek() == i);
+		evens.remove();
+	}
+
+	assert(evens.isEmpty());
+
+	evens.meld(std::move(copy));
+	evens.meld(HeapType());
+
+	assert(evens.getNodes() == 499 && evens.pop() == 996);
+
+	bool thrown(false);
+
+	try {
+
+		HeapType().peek();
+
+	} catch (int) {
+
+		thrown = true;
+	}
+
+	assert(thrown);
+}
+
+/*
+* Unit test for meld, PairingHeap & SkewHeap
+*/
+void meld() {
+
+	meldsert<MaxHeap<int>>();
+	meldsert<PairingHeap<int>>();
+	meldsert<SkewHeap<int>>();
+
+	std::string testArr[10]{ "GYRO", "CISCO", "POPS", "DISK", "BASE", "QUAVO",
+	                         "MONSTER", "JACKA", "ELON", "ACE" };
+
+	PairingHeap<std::string, std::greater<std::string>> pairing(testArr, 10);
+	SkewHeap<std::string, std::greater<std::string>> skew(testArr, 10);
+
+	for (const char* word : { "ACE", "BASE", "CISCO", "DISK", "ELON" }) {
+
+		assert(pairing.pop() == word && skew.pop() == word);
+	}
+
+	// Sorted adds build the deepest pairing & skew heaps
+	PairingHeap<int> deepPairing;
+	SkewHeap<int> deepSkew;
+
+	for (int i(0); i < 100000; ++i) {
+
+		deepPairing.add(i);
+		deepSkew.add(-i);
+	}
+
+	PairingHeap<int> pairingCopy(deepPairing);
+	SkewHeap<int> skewCopy;
+	skewCopy = deepSkew;
+
+	assert(pairingCopy.pop() == 99999 && skewCopy.pop() == 0 && skewCopy.pop() == -1);
+
+	// Copies failing partway must free the nodes already copied
+	static int live(0), copiesLeft(0);
+
+	struct Fragile {
+
+		int key;
+
+		Fragile(int key) :key(key) { ++live; }
+
+		Fragile(const Fragile& other) :key(other.key) {
+
+			if (copiesLeft-- == 0) {
+
+				throw std::runtime_error("copy");
+			}
+
+			++live;
+		}
+
+		~Fragile() { --live; }
+
+		bool operator<(const Fragile& other) const { return this->key < other.key; }
+
+		bool operator==(const Fragile& other) const { return this->key == other.key; }
+	};
+
+	auto partialCopy = [](auto& heap) {
+
+		copiesLeft = INT_MAX;
+
+		for (int i(0); i < 1000; ++i) {
+
+			heap.add(Fragile((i * 7919) % 1000));
+		}
+
+		int before(live);
+		bool thrown(false);
+		copiesLeft = 500;
+
+		try {
+
+			auto copy(heap);
+
+		} catch (const std::runtime_error&) {
+
+			thrown = true;
+		}
+
+		assert(thrown && live == before && heap.getNodes() == 1000);
+	};
+
+	PairingHeap<Fragile> fragilePairing;
+	SkewHeap<Fragile> fragileSkew;
+	partialCopy(fragilePairing);
+	partialCopy(fragileSkew);
+
+	assert(fragilePairing.contains(Fragile(999)) && fragileSkew.contains(Fragile(0)));
+}
+
+/*
+* Unit test for RadixHeap
+*/
+void radixHeap() {
+
+	RadixHeap<unsigned, std::string> heap;
+
+	assert(heap.isEmpty() && heap.getLast() == 0);
+
+	bool thrown = false;
+
+	try {
+
+		heap.pop();
+
+	} catch (int e) {
+
+		thrown = true;
+	}
+
+	assert(thrown);
+
+	unsigned keys[10]{ 42, 7, 1000000, 7, 0, 65536, 300, 4000000000u, 42, 9 };
+
+	for (unsigned key : keys) {
+
+		heap.add(key, std::to_string(key));
+	}
+
+	assert(heap.getNodes() == 10 && heap.peek().first == 0);
+
+	std::sort(keys, keys + 10);
+
+	for (int i(0); i < 5; ++i) {
+
+		assert(heap.peek().first == keys[i]);
+
+		RadixHeap<unsigned, std::string>::Item item = heap.pop();
+
+		assert(item.first == keys[i] && item.second == std::to_string(keys[i]));
+	}
+
+	assert(heap.getLast() == 42 && heap.getNodes() == 5);
+
+	// Keys may equal but not precede the last key removed
+	heap.add(42, "again");
+	assert(heap.pop().second == "again");
+
+	thrown = false;
+
+	try {
+
+		heap.add(41, "early");
+
+	} catch (const std::invalid_argument& e) {
+
+		thrown = true;
+	}
+
+	assert(thrown && heap.getNodes() == 5);
+
+	// Monotone workload, adding keys past each one removed
+	for (int i(0); i < 10000; ++i) {
+
+		unsigned key = heap.pop().first;
+
+		heap.add(key + (i * 7919) % 1000, "");
+		assert(heap.getLast() == key);
+	}
+
+	heap.clear();
+	assert(heap.isEmpty() && heap.getNodes() == 0);
+
+	RadixHeap<long long, int> signedHeap;
+
+	long long signedKeys[6]{ 5, -3, LLONG_MIN, LLONG_MAX, 0, -3 };
+
+	for (long long key : signedKeys) {
+
+		signedHeap.add(key, 1);
+	}
+
+	std::sort(signedKeys, signedKeys + 6);
+
+	for (long long key : signedKeys) {
+
+		assert(signedHeap.peek().first == key && signedHeap.pop().first == key);
+	}
+
+	assert(signedHeap.isEmpty() && signedHeap.getLast() == LLONG_MAX);
+}
+
+/*
+* Unit test for KeyedHeap
+*/
+void keyedHeap() {
+
+	KeyedHeap<int, std::string> heap;
+
+	assert(heap.isEmpty());
+
+	bool thrown = false;
+
+	try {
+
+		heap.pop();
+
+	} catch (int e) {
+
+		thrown = true;
+	}
+
+	assert(thrown);
+
+	std::string testArr[10]{ "GYRO", "CISCO", "POPS", "DISK", "BASE", "QUAVO",
+	                         "MONSTER", "JACKA", "ELON", "ACE" };
+
+	heap.reserve(10);
+
+	for (int i(0); i < 10; ++i) {
+
+		heap.add(i * 37 % 10, testArr[i]);
+	}
+
+	assert(heap.getNodes() == 10 && heap.peekKey() == 9 && heap.peekValue() == "JACKA");
+
+	heap.peekValue() += "!";
+
+	KeyedHeap<int, std::string>::Item item = heap.pop();
+
+	assert(item.first == 9 && item.second == "JACKA!");
+
+	heap.remove();
+	assert(heap.peekKey() == 7 && heap.getNodes() == 8);
+
+	// Slots freed by pops are reused by adds
+	std::string moved("LATE");
+
+	heap.add(100, std::move(moved));
+	heap.add(-1, "FIRST");
+
+	assert(heap.pop().second == "LATE");
+
+	for (int key(7); key >= 0; --key) {
+
+		item = heap.pop();
+
+		assert(item.first == key && item.second == testArr[key * 3 % 10]);
+	}
+
+	assert(heap.pop().second == "FIRST" && heap.isEmpty());
+
+	// Ordered by the given comparator, equal keys keeping every value
+	KeyedHeap<double, int, std::greater<double>> minHeap;
+
+	for (int i(0); i < 1000; ++i) {
+
+		minHeap.add((i * 7919) % 100 / 4.0, i);
+	}
+
+	double last = -1;
+	long long sum = 0;
+
+	while (!minHeap.isEmpty()) {
+
+		assert(minHeap.peekKey() >= last);
+
+		last = minHeap.peekKey();
+		sum += minHeap.pop().second;
+	}
+
+	assert(sum == 999 * 1000 / 2);
+
+	// Values removed or popped are released, not kept in their slots
+	KeyedHeap<int, std::shared_ptr<int>> owners;
+	std::shared_ptr<int> shared(new int(1));
+
+	owners.add(1, shared);
+	owners.add(2, shared);
+	assert(shared.use_count() == 3);
+
+	owners.remove();
+	assert(shared.use_count() == 2);
+
+	owners.pop();
+	assert(shared.use_count() == 1);
+
+	heap.add(1, "ONE");
+	heap.clear();
+	assert(heap.isEmpty() && heap.getNodes() == 0);
+}
+
+/*
+* Unit test for ordered iteration & the unordered view
+*/
+void orderedIterator() {
+
+	int testArr[10]{ 42, 7, 93, 7, 0, 65, 30, 81, 42, 9 };
+
+	MaxHeap<int> heap(testArr, 10);
+
+	assert(heap.orderedBegin() == heap.orderedBegin() && heap.orderedBegin() != heap.orderedEnd());
+
+	std::vector<int> visited(heap.orderedBegin(), heap.orderedEnd());
+	std::vector<int> sorted(testArr, testArr + 10);
+
+	std::sort(sorted.begin(), sorted.end(), std::greater<int>());
+
+	assert(visited == sorted && heap.getNodes() == 10 && heap.peek() == 93);
+
+	// The first k items without visiting the rest
+	MaxHeap<int>::OrderedIterator it = heap.orderedBegin();
+
+	assert(*it++ == 93 && *it == 81 && *++it == 65);
+
+	// Unordered scan of the array in place
+	long long sum = 0;
+
+	for (int item : heap) {
+
+		sum += item;
+	}
+
+	assert(sum == 376 && heap.end() - heap.begin() == 10);
+
+	// Sorted in place, the array is still a heap
+	heap.sort();
+
+	assert(std::equal(heap.begin(), heap.end(), sorted.begin()) && heap.pop() == 93 && heap.pop() == 81);
+
+	MinHeap<std::string> words;
+	std::string testWords[5]{ "GYRO", "CISCO", "POPS", "DISK", "BASE" };
+
+	for (const std::string& word : testWords) {
+
+		words.add(word);
+	}
+
+	MinHeap<std::string>::OrderedIterator word = words.orderedBegin();
+
+	assert(word->size() == 4 && *word == "BASE" && *++word == "CISCO");
+
+	DaryHeap<int, 4> dary(testArr, 10);
+
+	assert(std::vector<int>(dary.orderedBegin(), dary.orderedEnd()) == sorted);
+
+	MaxHeap<int> empty;
+
+	assert(empty.orderedBegin() == empty.orderedEnd() && empty.begin() == empty.end());
+}
+
+/*
+* Unit test for MinMaxHeap
+*/
+void minMaxHeap() {
+
+	MinMaxHeap<int> heap;
+
+	assert(heap.isEmpty() && heap.getBound() == 0);
+
+	bool thrown = false;
+
+	try {
+
+		heap.peekMin();
+
+	} catch (int e) {
+
+		thrown = true;
+	}
+
+	assert(thrown);
+
+	heap.add(5);
+	assert(heap.peekMin() == 5 && heap.peekMax() == 5);
+
+	heap.add(9);
+	heap.add(1);
+	assert(heap.peekMin() == 1 && heap.peekMax() == 9 && heap.peek() == 9);
+
+	// Both ends drained in step with a sorted copy of the items
+	std::vector<int> items;
+
+	for (int i(0); i < 1000; ++i) {
+
+		items.push_back((i * 7919) % 997);
+	}
+
+	MinMaxHeap<int> fromArray(items.data(), 1000);
+
+	for (int item : items) {
+
+		heap.add(item);
+	}
+
+	items.insert(items.end(), { 5, 9, 1 });
+	std::sort(items.begin(), items.end());
+
+	std::size_t low(0), high(items.size());
+
+	for (int i(0); !heap.isEmpty(); ++i) {
+
+		assert(heap.peekMin() == items[low] && heap.peekMax() == items[high - 1]);
+
+		if (i % 3 == 0) {
+
+			assert(heap.popMin() == items[low++]);
+
+		} else {
+
+			assert(heap.popMax() == items[--high]);
+		}
+	}
+
+	assert(low == high);
+
+	for (int i(0); i < 500; ++i) {
+
+		i % 2 ? fromArray.remove() : fromArray.removeMin();
+	}
+
+	assert(fromArray.getNodes() == 500 && fromArray.peekMin() == items[253] && fromArray.peekMax() == items[752]);
+
+	// Bounded heap evicts the least item on overflow
+	MinMaxHeap<std::string> bounded(3);
+
+	for (const char* word : { "GYRO", "CISCO", "POPS", "DISK", "BASE", "QUAVO" }) {
+
+		bounded.add(word);
+	}
+
+	assert(bounded.getNodes() == 3 && bounded.getBound() == 3);
+	assert(bounded.popMin() == "GYRO" && bounded.popMin() == "POPS" && bounded.popMin() == "QUAVO");
+
+	MinMaxHeap<int, std::greater<int>> reversed(2, std::greater<int>());
+
+	int testArr[5]{ 42, 7, 93, 0, 65 };
+
+	reversed = MaxHeap<int>(testArr, 5);
+
+	assert(reversed.getNodes() == 2 && reversed.peekMax() == 0 && reversed.peekMin() == 7);
+	assert(reversed.contains(7) && !reversed.contains(42));
+
+	MinMaxHeap<int> copy(fromArray);
+
+	assert(copy == fromArray && copy.popMax() == fromArray.popMax());
+}
+
+/*
+* Unit test for HeapStats, counting only when compiled with HEAP_INSTRUMENT
+*/
+void heapStats() {
+
+	HeapStats::local().clear();
+
+	MaxHeap<int> heap;
+
+	// Sorted adds bubble every item up to the root
+	for (int i(0); i < 1000; ++i) {
+
+		heap.add(i);
+	}
+
+	for (int i(0); i < 500; ++i) {
+
+		heap.pop();
+	}
+
+#ifdef HEAP_INSTRUMENT
+	const HeapStats& stats = heap.getStats();
+
+	assert(stats.adds == 1000 && stats.removes == 500 && stats.peakSize == 1000);
+	assert(stats.reallocations > 0 && stats.comparisons >= 1000 && stats.moves >= 3000);
+	assert(stats.depths[0] == 1 && stats.depths[9] >= 1000 - 511);
+
+	long long sifts = 0;
+
+	for (long long count : stats.depths) {
+
+		sifts += count;
+	}
+
+	assert(sifts == 1500);
+
+	// Other threads aggregate apart, the heap's own work still counted
+	std::thread other([]() {
+
+		MaxHeap<int> otherHeap;
+
+		otherHeap.add(1);
+		assert(HeapStats::local().adds == 1);
+	});
+
+	other.join();
+
+	assert(HeapStats::local().adds == 1000 && HeapStats::local().comparisons == stats.comparisons);
+	assert(heap.getStats().toJson().find("\"adds\":1000,\"removes\":500,") == 1);
+
+	// MinMaxHeap & IndexedHeap count their own work too
+	MinMaxHeap<int> minMax;
+	IndexedHeap<int> indexed;
+
+	for (int i(0); i < 100; ++i) {
+
+		minMax.add(i);
+		indexed.add(i);
+	}
+
+	minMax.popMin();
+	minMax.popMax();
+	indexed.erase(indexed.peekHandle());
+	indexed.remove();
+
+	for (const HeapStats* counted : { &minMax.getStats(), &indexed.getStats() }) {
+
+		assert(counted->adds == 100 && counted->removes == 2 && counted->peakSize == 100);
+		assert(counted->comparisons >= 100 && counted->moves >= 200);
+
+		sifts = 0;
+
+		for (long long count : counted->depths) {
+
+			sifts += count;
+		}
+
+		assert(sifts == 102);
+	}
+#else
+	assert(HeapStats::local().adds == 0 && HeapStats::local().comparisons == 0);
+#endif
+
+	HeapStats total;
+
+	total.adds = 2;
+	total.depths[3] = 1;
+	total.merge(total);
+
+	assert(total.toJson() == "{\"adds\":4,\"removes\":0,\"comparisons\":0,\"moves\":0,"
+	                         "\"reallocations\":0,\"peakSize\":0,\"siftDepths\":[0,0,0,2]}");
+
+	total.clear();
+	assert(total.toJson().find("\"siftDepths\":[]") != std::string::npos);
+}
+
+/*
+* Builds a sorted table at compile time through StaticHeap
+* @return the table, greatest first
+*/
+constexpr std::array<int, 8> staticTable() {
+
+	int testArr[10]{ 42, 7, 93, 7, 0, 65, 30, 81, 42, 9 };
+
+	StaticHeap<int, 8> heap(testArr, 6);
+
+	heap.add(testArr[6]);
+	heap.remove();
+	heap.add(testArr[7]);
+	heap.add(testArr[8]);
+	heap.add(testArr[9]);
+
+	return heap.sorted();
+}
+
+/*
+* Unit test for StaticHeap
+*/
+void staticHeap() {
+
+	constexpr std::array<int, 8> table = staticTable();
+
+	static_assert(table[0] == 81 && table[1] == 65 && table[7] == 0, "heap sorted at compile time");
+	static_assert(sizeof(StaticHeap<std::uint8_t, 64>) == 65, "no allocation & one byte of bookkeeping");
+
+	StaticHeap<std::string, 4, std::greater<std::string>> heap;
+
+	assert(heap.isEmpty() && heap.getCapacity() == 4);
+
+	bool thrown = false;
+
+	try {
+
+		heap.pop();
+
+	} catch (int e) {
+
+		thrown = true;
+	}
+
+	assert(thrown);
+
+	for (const char* word : { "GYRO", "CISCO", "POPS", "DISK" }) {
+
+		assert(heap.add(word));
+	}
+
+	assert(heap.isFull() && !heap.add("BASE") && heap.getNodes() == 4);
+	assert(heap.peek() == "CISCO" && heap.contains("POPS") && !heap.contains("BASE"));
+
+	std::array<std::string, 4> sorted = heap.sorted();
+
+	assert(sorted[0] == "CISCO" && sorted[3] == "POPS" && heap.getNodes() == 4);
+	assert(heap.pop() == "CISCO" && heap.pop() == "DISK" && heap.add("ACE") && heap.pop() == "ACE");
+
+	heap.clear();
+	assert(heap.isEmpty());
+
+	// A full heap drains in order, against a sorted copy
+	StaticHeap<int, 64> numbers;
+	std::vector<int> items;
+
+	for (int i(0); i < 64; ++i) {
+
+		items.push_back((i * 37) % 64);
+		numbers.add(items.back());
+	}
+
+	std::sort(items.begin(), items.end(), std::greater<int>());
+
+	for (int item : items) {
+
+		assert(numbers.pop() == item);
+	}
+
+	// Comparators that cannot be derived from are held as members
+	bool (*ascending)(int, int) = [](int item1, int item2) { return item1 > item2; };
+	StaticHeap<int, 4, bool (*)(int, int)> least(ascending);
+
+	assert(least.add(3) && least.add(1) && least.add(2) && least.pop() == 1);
+}
+
 /*
 * Unit test for equality operator overloads
 */
@@ -292,6 +2092,30 @@ void runTests() {
 	peek();
 	getNodes();
 	getHeight();
+	growth();
+	minHeap();
+	moveSemantics();
+	daryHeap();
+	childSelect();
+	indexedHeap();
+	hashIndex();
+	addRange();
+	heapSort();
+	batches();
+	concurrentHeap();
+	lockFreeHeap();
+	allocators();
+	mappedHeap();
+	externalHeap();
+	topK();
+	parallelHeap();
+	meld();
+	radixHeap();
+	keyedHeap();
+	orderedIterator();
+	minMaxHeap();
+	heapStats();
+	staticHeap();
 	operators();
 }
 
@@ -0,0 +1,188 @@
+#include "topk.h"
+/*
+* topk.cpp
+*
+* Implementations for TopK class
+*
+* @author Juan Arias
+*
+*/
+
+#include <algorithm>
+#include <utility>
+
+  //**************// //**************// //**************//
+ //*  PUBLIC:   *// //*  PUBLIC:   *// //*  PUBLIC:   *//
+//**************// //**************// //**************//
+
+/*
+* Constructs empty selector
+* @param k The number of items to keep
+* @param comp The comparator to select by
+*/
+template <class T, class Compare>
+TopK<T, Compare>::TopK(int k, const Compare& comp) :heap(Inverse{comp}), k(std::max(k, 0)), comp(comp) {
+
+	this->heap.reserve(this->k);
+}
+
+/*
+* Offer item to the selector
+* @param item The item to offer
+* @return true if kept, false if rejected
+*/
+template <class T, class Compare>
+bool TopK<T, Compare>::add(const T& item) {
+
+	return this->offer(item);
+}
+
+/*
+* Offer item to the selector by moving it
+* @param item The item to offer
+* @return true if kept, false if rejected
+*/
+template <class T, class Compare>
+bool TopK<T, Compare>::add(T&& item) {
+
+	return this->offer(std::move(item));
+}
+
+/*
+* Offer every item in the range to the selector
+* @param first The iterator to the first item
+* @param last The iterator past the last item
+*/
+template <class T, class Compare>
+template <class Iterator>
+void TopK<T, Compare>::addRange(Iterator first, Iterator last) {
+
+	for (; first != last; ++first) {
+
+		this->offer(*first);
+	}
+}
+
+/*
+* Offer every item kept by another selector, such as one per thread
+* @param other The other selector
+*/
+template <class T, class Compare>
+void TopK<T, Compare>::merge(const TopK& other) {
+
+	// Its own items offered back would be kept twice
+	if (&other == this) {
+
+		return;
+	}
+
+	// Greatest first, so once one is rejected so is every one after it
+	for (const T& item : other.sortedResult()) {
+
+		if (!this->offer(item)) {
+
+			break;
+		}
+	}
+}
+
+/*
+* Get the items kept, greatest first
+* @return the items
+*/
+template <class T, class Compare>
+std::vector<T> TopK<T, Compare>::sortedResult() const {
+
+	BasicHeap<T, Inverse> copy(this->heap);
+
+	std::vector<T> items;
+	items.reserve(copy.getNodes());
+
+	while (!copy.isEmpty()) {
+
+		items.push_back(copy.pop());
+	}
+
+	std::reverse(items.begin(), items.end());
+
+	return items;
+}
+
+/*
+* Get the least item kept, which items offered must beat once full
+* @return the least item kept
+*/
+template <class T, class Compare>
+const T& TopK<T, Compare>::peek() const {
+
+	return this->heap.peek();
+}
+
+/*
+* Get the number of items kept
+* @return the number of items kept
+*/
+template <class T, class Compare>
+int TopK<T, Compare>::size() const {
+
+	return this->heap.getNodes();
+}
+
+/*
+* Get the number of items to keep
+* @return K
+*/
+template <class T, class Compare>
+int TopK<T, Compare>::getK() const {
+
+	return this->k;
+}
+
+/*
+* Check if no item is kept
+* @return true if empty, else false
+*/
+template <class T, class Compare>
+bool TopK<T, Compare>::isEmpty() const {
+
+	return this->heap.isEmpty();
+}
+
+/*
+* Clear the selector
+*/
+template <class T, class Compare>
+void TopK<T, Compare>::clear() {
+
+	this->heap.clear();
+	this->heap.reserve(this->k);
+}
+
+  //**************// //**************// //**************//
+ //*  PRIVATE:  *// //*  PRIVATE:  *// //*  PRIVATE:  *//
+//**************// //**************// //**************//
+
+/*
+* Offers item to the selector
+* @param item The item to offer, forwarded into the heap
+* @return true if kept, false if rejected
+*/
+template <class T, class Compare>
+template <class Item>
+bool TopK<T, Compare>::offer(Item&& item) {
+
+	if (this->heap.getNodes() < this->k) {
+
+		this->heap.add(std::forward<Item>(item));
+		return true;
+	}
+
+	// Rejected by the root before any trickling, the common case once full
+	if (this->k == 0 || !this->comp(this->heap.peek(), item)) {
+
+		return false;
+	}
+
+	this->heap.replaceTop(std::forward<Item>(item));
+	return true;
+}
@@ -0,0 +1,128 @@
+/*
+* topk.h
+*
+* Specifications for TopK class
+*
+* @author Juan Arias
+*
+*/
+
+#ifndef TOPK_H
+#define TOPK_H
+
+#include <functional>
+#include <vector>
+#include "basicheap.h"
+
+/*
+* A TopK keeps the K items of a stream that compare greatest by Compare,
+* in a BasicHeap of fixed capacity K with the least of them in the root.
+* Once full, an item not greater than the root is rejected with a single
+* comparison, and one that is replaces the root & is trickled down once.
+*/
+template <class T, class Compare = std::less<T>>
+class TopK {
+
+public:
+
+	/*
+	* Constructs empty selector
+	* @param k The number of items to keep
+	* @param comp The comparator to select by
+	*/
+	explicit TopK(int k, const Compare& comp = Compare());
+
+	/*
+	* Offer item to the selector
+	* @param item The item to offer
+	* @return true if kept, false if rejected
+	*/
+	bool add(const T& item);
+
+	/*
+	* Offer item to the selector by moving it
+	* @param item The item to offer
+	* @return true if kept, false if rejected
+	*/
+	bool add(T&& item);
+
+	/*
+	* Offer every item in the range to the selector
+	* @param first The iterator to the first item
+	* @param last The iterator past the last item
+	*/
+	template <class Iterator>
+	void addRange(Iterator first, Iterator last);
+
+	/*
+	* Offer every item kept by another selector, such as one per thread
+	* @param other The other selector
+	*/
+	void merge(const TopK& other);
+
+	/*
+	* Get the items kept, greatest first
+	* @return the items
+	*/
+	std::vector<T> sortedResult() const;
+
+	/*
+	* Get the least item kept, which items offered must beat once full
+	* @return the least item kept
+	*/
+	const T& peek() const;
+
+	/*
+	* Get the number of items kept
+	* @return the number of items kept
+	*/
+	int size() const;
+
+	/*
+	* Get the number of items to keep
+	* @return K
+	*/
+	int getK() const;
+
+	/*
+	* Check if no item is kept
+	* @return true if empty, else false
+	*/
+	bool isEmpty() const;
+
+	/*
+	* Clear the selector
+	*/
+	void clear();
+
+private:
+
+	// Comparator ordering the least item kept first
+	struct Inverse {
+
+		Compare comp;
+
+		bool operator()(const T& item1, const T& item2) const { return this->comp(item2, item1); }
+	};
+
+	// Items kept, the least in the root
+	BasicHeap<T, Inverse> heap;
+
+	// Number of items to keep
+	int k;
+
+	// Comparator selecting items, comp(a, b) is true if b is greater
+	Compare comp;
+
+	/*
+	* Offers item to the selector
+	* @param item The item to offer, forwarded into the heap
+	* @return true if kept, false if rejected
+	*/
+	template <class Item>
+	bool offer(Item&& item);
+
+};
+
+#include "topk.cpp"
+#endif // TOPK_H